@@ -0,0 +1,55 @@
+# Try to find lz4 library
+#
+# Use this module as:
+#   find_package(lz4)
+#
+# or:
+#   find_package(lz4 REQUIRED)
+#
+# This will define the following variables:
+#
+#   lz4_FOUND           True if the system has the lz4 library.
+#   lz4_INCLUDE_DIRS    Include directories needed to use lz4.
+#   lz4_LIBRARIES       Libraries needed to link to lz4.
+#
+# The following cache variables may also be set:
+#
+# lz4_INCLUDE_DIR     The directory containing lz4.h.
+# lz4_LIBRARY         The path to the lz4 static library.
+
+find_path(lz4_INCLUDE_DIR NAMES lz4.h PATH_SUFFIXES include)
+
+find_library(lz4_LIBRARY NAMES liblz4.a PATH_SUFFIXES lib)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(lz4
+  FOUND_VAR lz4_FOUND
+  REQUIRED_VARS
+    lz4_LIBRARY
+    lz4_INCLUDE_DIR
+)
+
+if(lz4_FOUND)
+  set(lz4_LIBRARIES ${lz4_LIBRARY})
+  set(lz4_INCLUDE_DIRS ${lz4_INCLUDE_DIR})
+else()
+  if(lz4_FIND_REQUIRED)
+    message(FATAL_ERROR "Cannot find lz4!")
+  else()
+    message(WARNING "lz4 is not found!")
+  endif()
+endif()
+
+if(lz4_FOUND AND NOT TARGET lz4::lz4)
+  add_library(lz4::lz4 UNKNOWN IMPORTED)
+  set_target_properties(lz4::lz4
+    PROPERTIES
+      IMPORTED_LOCATION "${lz4_LIBRARY}"
+      INTERFACE_INCLUDE_DIRECTORIES "${lz4_INCLUDE_DIR}"
+  )
+endif()
+
+mark_as_advanced(
+  lz4_INCLUDE_DIR
+  lz4_LIBRARY
+)
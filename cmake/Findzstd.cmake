@@ -0,0 +1,55 @@
+# Try to find zstd library
+#
+# Use this module as:
+#   find_package(zstd)
+#
+# or:
+#   find_package(zstd REQUIRED)
+#
+# This will define the following variables:
+#
+#   zstd_FOUND           True if the system has the zstd library.
+#   zstd_INCLUDE_DIRS    Include directories needed to use zstd.
+#   zstd_LIBRARIES       Libraries needed to link to zstd.
+#
+# The following cache variables may also be set:
+#
+# zstd_INCLUDE_DIR     The directory containing zstd.h.
+# zstd_LIBRARY         The path to the zstd static library.
+
+find_path(zstd_INCLUDE_DIR NAMES zstd.h PATH_SUFFIXES include)
+
+find_library(zstd_LIBRARY NAMES libzstd.a PATH_SUFFIXES lib)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(zstd
+  FOUND_VAR zstd_FOUND
+  REQUIRED_VARS
+    zstd_LIBRARY
+    zstd_INCLUDE_DIR
+)
+
+if(zstd_FOUND)
+  set(zstd_LIBRARIES ${zstd_LIBRARY})
+  set(zstd_INCLUDE_DIRS ${zstd_INCLUDE_DIR})
+else()
+  if(zstd_FIND_REQUIRED)
+    message(FATAL_ERROR "Cannot find zstd!")
+  else()
+    message(WARNING "zstd is not found!")
+  endif()
+endif()
+
+if(zstd_FOUND AND NOT TARGET zstd::zstd)
+  add_library(zstd::zstd UNKNOWN IMPORTED)
+  set_target_properties(zstd::zstd
+    PROPERTIES
+      IMPORTED_LOCATION "${zstd_LIBRARY}"
+      INTERFACE_INCLUDE_DIRECTORIES "${zstd_INCLUDE_DIR}"
+  )
+endif()
+
+mark_as_advanced(
+  zstd_INCLUDE_DIR
+  zstd_LIBRARY
+)
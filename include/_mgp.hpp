@@ -277,6 +277,36 @@ inline mgp_vertex *vertices_iterator_next(mgp_vertices_iterator *it) {
   return MgInvoke<mgp_vertex *>(mgp_vertices_iterator_next, it);
 }
 
+// mgp_csr_graph
+
+inline mgp_csr_graph *graph_project_csr(mgp_graph *graph, const char *label, const char *edge_type,
+                                        const char *weight_property, double default_weight, mgp_memory *memory) {
+  return MgInvoke<mgp_csr_graph *>(mgp_graph_project_csr, graph, label, edge_type, weight_property, default_weight,
+                                   memory);
+}
+
+inline void csr_graph_destroy(mgp_csr_graph *csr) { mgp_csr_graph_destroy(csr); }
+
+inline size_t csr_graph_vertex_count(mgp_csr_graph *csr) { return MgInvoke<size_t>(mgp_csr_graph_vertex_count, csr); }
+
+inline size_t csr_graph_edge_count(mgp_csr_graph *csr) { return MgInvoke<size_t>(mgp_csr_graph_edge_count, csr); }
+
+inline const int64_t *csr_graph_vertex_ids(mgp_csr_graph *csr) {
+  return MgInvoke<const int64_t *>(mgp_csr_graph_vertex_ids, csr);
+}
+
+inline const size_t *csr_graph_offsets(mgp_csr_graph *csr) {
+  return MgInvoke<const size_t *>(mgp_csr_graph_offsets, csr);
+}
+
+inline const size_t *csr_graph_neighbors(mgp_csr_graph *csr) {
+  return MgInvoke<const size_t *>(mgp_csr_graph_neighbors, csr);
+}
+
+inline const double *csr_graph_weights(mgp_csr_graph *csr) {
+  return MgInvoke<const double *>(mgp_csr_graph_weights, csr);
+}
+
 // mgp_edges_iterator
 
 inline void edges_iterator_destroy(mgp_edges_iterator *it) { mgp_edges_iterator_destroy(it); }
@@ -1195,6 +1195,57 @@ enum mgp_error mgp_duration_sub(struct mgp_duration *first, struct mgp_duration
 /// Result is NULL if the end of the iteration has been reached.
 /// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate a mgp_vertex.
 enum mgp_error mgp_vertices_iterator_next(struct mgp_vertices_iterator *it, struct mgp_vertex **result);
+
+/// Read-only snapshot of the graph in the compressed sparse row format.
+///
+/// Vertices of the snapshot are numbered from 0 to vertex count - 1. The out-neighbors of the vertex i are stored in
+/// the neighbors array, from the index offsets[i] up to, but not including, offsets[i + 1]. The weights array, if
+/// any, holds the weight of the edge at the same index of the neighbors array. The arrays are owned by the
+/// mgp_csr_graph and remain valid until it is destroyed.
+struct mgp_csr_graph;
+
+/// Build a compressed sparse row snapshot of the out-edges of the given graph, which algorithms can traverse without
+/// going through mgp_vertex and mgp_edge.
+/// If `label` is not NULL, only the vertices with that label, and the edges between them, are projected.
+/// If `edge_type` is not NULL, only the edges of that type are projected.
+/// If `weight_property` is not NULL, the weights array holds the value of that edge property, or `default_weight`
+/// for the edges which don't have it. Otherwise, there is no weights array.
+/// If the graph is immutable, the snapshot is shared with later calls in the same query which ask for the same
+/// projection, so it is built only once.
+/// Resulting mgp_csr_graph must be freed with mgp_csr_graph_destroy.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate the snapshot.
+/// Return mgp_error::MGP_ERROR_VALUE_CONVERSION if a weight is neither an integer nor a double.
+enum mgp_error mgp_graph_project_csr(struct mgp_graph *graph, const char *label, const char *edge_type,
+                                     const char *weight_property, double default_weight, struct mgp_memory *memory,
+                                     struct mgp_csr_graph **result);
+
+/// Free the memory used by a mgp_csr_graph.
+void mgp_csr_graph_destroy(struct mgp_csr_graph *csr);
+
+/// Get the number of vertices in the snapshot.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_csr_graph_vertex_count(struct mgp_csr_graph *csr, size_t *result);
+
+/// Get the number of edges in the snapshot.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_csr_graph_edge_count(struct mgp_csr_graph *csr, size_t *result);
+
+/// Get the array of vertex count elements which maps the vertices of the snapshot to the IDs of the vertices in the
+/// graph, as returned by mgp_vertex_get_id.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_csr_graph_vertex_ids(struct mgp_csr_graph *csr, const int64_t **result);
+
+/// Get the array of vertex count + 1 offsets into the neighbors array.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_csr_graph_offsets(struct mgp_csr_graph *csr, const size_t **result);
+
+/// Get the array of edge count out-neighbors.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_csr_graph_neighbors(struct mgp_csr_graph *csr, const size_t **result);
+
+/// Get the array of edge count weights, or NULL if no weight property was projected or there are no edges.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_csr_graph_weights(struct mgp_csr_graph *csr, const double **result);
 ///@}
 
 /// @name Type System
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <string_view>
 #include <type_traits>
 
 #include "communication/bolt/v1/codes.hpp"
@@ -45,6 +46,9 @@ class BaseEncoder {
    */
   void UpdateVersion(int major_v) { major_v_ = major_v; }
 
+  /** Returns the major version of the Bolt protocol used. */
+  int Version() const { return major_v_; }
+
   void WriteRAW(const uint8_t *data, uint64_t len) { buffer_.Write(data, len); }
 
   void WriteRAW(const char *data, uint64_t len) { WriteRAW((const uint8_t *)data, len); }
@@ -104,9 +108,9 @@ class BaseEncoder {
     }
   }
 
-  void WriteString(const std::string &value) {
+  void WriteString(std::string_view value) {
     WriteTypeSize(value.size(), MarkerString);
-    WriteRAW(value.c_str(), value.size());
+    WriteRAW(value.data(), value.size());
   }
 
   void WriteList(const std::vector<Value> &value) {
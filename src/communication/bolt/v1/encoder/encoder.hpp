@@ -29,12 +29,14 @@ class Encoder : private BaseEncoder<Buffer> {
   using BaseEncoder<Buffer>::WriteRAW;
   using BaseEncoder<Buffer>::WriteList;
   using BaseEncoder<Buffer>::WriteMap;
+  using BaseEncoder<Buffer>::WriteTypeSize;
   using BaseEncoder<Buffer>::buffer_;
 
  public:
   Encoder(Buffer &buffer) : BaseEncoder<Buffer>(buffer) {}
 
   using BaseEncoder<Buffer>::UpdateVersion;
+  using BaseEncoder<Buffer>::Version;
 
   /**
    * Sends a Record message.
@@ -60,6 +62,25 @@ class Encoder : private BaseEncoder<Buffer> {
     return buffer_.Flush(true);
   }
 
+  /**
+   * Sends a Record message whose fields were already encoded.
+   *
+   * This allows the caller to encode the fields straight from its own types
+   * instead of converting them to Value first.
+   *
+   * @param size the number of fields
+   * @param data the encoded fields
+   * @param len the number of bytes in data
+   */
+  bool MessageRecord(size_t size, const uint8_t *data, size_t len) {
+    WriteRAW(utils::UnderlyingCast(Marker::TinyStruct1));
+    WriteRAW(utils::UnderlyingCast(Signature::Record));
+    WriteTypeSize(size, MarkerList);
+    WriteRAW(data, len);
+    if (!buffer_.Flush(true)) return false;
+    return buffer_.Flush(true);
+  }
+
   /**
    * Sends a Success message.
    *
@@ -0,0 +1,279 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file Bolt encoding of memgraph types without converting them to Value.
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "communication/bolt/v1/codes.hpp"
+#include "communication/bolt/v1/encoder/base_encoder.hpp"
+#include "glue/communication.hpp"
+#include "query/typed_value.hpp"
+#include "storage/v2/edge_accessor.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/result.hpp"
+#include "storage/v2/storage.hpp"
+#include "storage/v2/vertex_accessor.hpp"
+#include "storage/v2/view.hpp"
+#include "utils/cast.hpp"
+#include "utils/temporal.hpp"
+
+namespace memgraph::glue {
+
+/// Buffer which keeps all of the written data in memory.
+///
+/// It is used to encode a whole record before it is handed over to the
+/// chunked buffer, so that nothing is sent to the client if the encoding of
+/// one of the fields fails halfway through.
+class BoltRecordBuffer final {
+ public:
+  void Write(const uint8_t *data, size_t len) { data_.insert(data_.end(), data, data + len); }
+
+  const uint8_t *data() const { return data_.data(); }
+  size_t size() const { return data_.size(); }
+
+  /// Clears the data, but keeps the allocated memory for the next record.
+  void Clear() { data_.clear(); }
+
+ private:
+  std::vector<uint8_t> data_;
+};
+
+/// Bolt encoder which writes query::TypedValue straight into the buffer.
+///
+/// ToBoltValue first copies the labels and the properties of every vertex and
+/// edge into a communication::bolt::Value with a std::map keyed by the
+/// property names. This encoder writes them as soon as they are read from the
+/// storage, and the names are written from the references kept by the
+/// storage's name-id mapper, so no intermediate values are built for the
+/// common types. Paths and graphs are still converted with ToBoltPath and
+/// ToBoltGraph.
+///
+/// @tparam TBuffer the output buffer that should be used
+template <typename TBuffer>
+class TypedValueEncoder final : public communication::bolt::BaseEncoder<TBuffer> {
+  using Base = communication::bolt::BaseEncoder<TBuffer>;
+
+ public:
+  TypedValueEncoder(TBuffer &buffer, const storage::Storage &db, storage::View view)
+      : Base(buffer), db_(&db), view_(view) {}
+
+  /// @throw std::bad_alloc
+  storage::Result<void> WriteTypedValue(const query::TypedValue &value) {
+    switch (value.type()) {
+      case query::TypedValue::Type::Null:
+        Base::WriteNull();
+        return {};
+      case query::TypedValue::Type::Bool:
+        Base::WriteBool(value.ValueBool());
+        return {};
+      case query::TypedValue::Type::Int:
+        Base::WriteInt(value.ValueInt());
+        return {};
+      case query::TypedValue::Type::Double:
+        Base::WriteDouble(value.ValueDouble());
+        return {};
+      case query::TypedValue::Type::String:
+        Base::WriteString(value.ValueString());
+        return {};
+      case query::TypedValue::Type::List: {
+        const auto &list = value.ValueList();
+        Base::WriteTypeSize(list.size(), communication::bolt::MarkerList);
+        for (const auto &v : list) {
+          auto maybe_written = WriteTypedValue(v);
+          if (maybe_written.HasError()) return maybe_written;
+        }
+        return {};
+      }
+      case query::TypedValue::Type::Map: {
+        const auto &map = value.ValueMap();
+        Base::WriteTypeSize(map.size(), communication::bolt::MarkerMap);
+        for (const auto &kv : map) {
+          Base::WriteString(kv.first);
+          auto maybe_written = WriteTypedValue(kv.second);
+          if (maybe_written.HasError()) return maybe_written;
+        }
+        return {};
+      }
+      case query::TypedValue::Type::Vertex:
+        return WriteVertexAccessor(value.ValueVertex().impl_);
+      case query::TypedValue::Type::Edge:
+        return WriteEdgeAccessor(value.ValueEdge().impl_);
+      case query::TypedValue::Type::Path: {
+        auto maybe_path = ToBoltPath(value.ValuePath(), *db_, view_);
+        if (maybe_path.HasError()) return maybe_path.GetError();
+        Base::WritePath(*maybe_path);
+        return {};
+      }
+      case query::TypedValue::Type::Date:
+        Base::WriteDate(value.ValueDate());
+        return {};
+      case query::TypedValue::Type::LocalTime:
+        Base::WriteLocalTime(value.ValueLocalTime());
+        return {};
+      case query::TypedValue::Type::LocalDateTime:
+        Base::WriteLocalDateTime(value.ValueLocalDateTime());
+        return {};
+      case query::TypedValue::Type::Duration:
+        Base::WriteDuration(value.ValueDuration());
+        return {};
+      case query::TypedValue::Type::Graph: {
+        auto maybe_graph = ToBoltGraph(value.ValueGraph(), *db_, view_);
+        if (maybe_graph.HasError()) return maybe_graph.GetError();
+        Base::WriteMap(*maybe_graph);
+        return {};
+      }
+    }
+  }
+
+  /// @throw std::bad_alloc
+  void WritePropertyValue(const storage::PropertyValue &value) {
+    switch (value.type()) {
+      case storage::PropertyValue::Type::Null:
+        Base::WriteNull();
+        return;
+      case storage::PropertyValue::Type::Bool:
+        Base::WriteBool(value.ValueBool());
+        return;
+      case storage::PropertyValue::Type::Int:
+        Base::WriteInt(value.ValueInt());
+        return;
+      case storage::PropertyValue::Type::Double:
+        Base::WriteDouble(value.ValueDouble());
+        return;
+      case storage::PropertyValue::Type::String:
+        Base::WriteString(value.ValueString());
+        return;
+      case storage::PropertyValue::Type::List: {
+        const auto &list = value.ValueList();
+        Base::WriteTypeSize(list.size(), communication::bolt::MarkerList);
+        for (const auto &v : list) WritePropertyValue(v);
+        return;
+      }
+      case storage::PropertyValue::Type::Map: {
+        const auto &map = value.ValueMap();
+        Base::WriteTypeSize(map.size(), communication::bolt::MarkerMap);
+        for (const auto &kv : map) {
+          Base::WriteString(kv.first);
+          WritePropertyValue(kv.second);
+        }
+        return;
+      }
+      case storage::PropertyValue::Type::TemporalData: {
+        const auto &temporal = value.ValueTemporalData();
+        switch (temporal.type) {
+          case storage::TemporalType::Date:
+            Base::WriteDate(utils::Date(temporal.microseconds));
+            return;
+          case storage::TemporalType::LocalTime:
+            Base::WriteLocalTime(utils::LocalTime(temporal.microseconds));
+            return;
+          case storage::TemporalType::LocalDateTime:
+            Base::WriteLocalDateTime(utils::LocalDateTime(temporal.microseconds));
+            return;
+          case storage::TemporalType::Duration:
+            Base::WriteDuration(utils::Duration(temporal.microseconds));
+            return;
+        }
+      }
+    }
+  }
+
+  /// Writes the vertex in the same format as Base::WriteVertex writes the
+  /// result of ToBoltVertex.
+  ///
+  /// @throw std::bad_alloc
+  storage::Result<void> WriteVertexAccessor(const storage::VertexAccessor &vertex) {
+    // Both are read before anything is written so that a deleted vertex
+    // doesn't leave a partially written value behind.
+    auto maybe_labels = vertex.Labels(view_);
+    if (maybe_labels.HasError()) return maybe_labels.GetError();
+    auto maybe_properties = vertex.Properties(view_);
+    if (maybe_properties.HasError()) return maybe_properties.GetError();
+
+    const auto id = communication::bolt::Id::FromUint(vertex.Gid().AsUint());
+    const int struct_n = 3 + 1 * int(Base::major_v_ > 4);  // element_id introduced from v5
+    Base::WriteRAW(utils::UnderlyingCast(communication::bolt::Marker::TinyStruct) + struct_n);
+    Base::WriteRAW(utils::UnderlyingCast(communication::bolt::Signature::Node));
+    Base::WriteInt(id.AsInt());
+
+    Base::WriteTypeSize(maybe_labels->size(), communication::bolt::MarkerList);
+    for (const auto &label : *maybe_labels) Base::WriteString(db_->LabelToName(label));
+
+    WriteProperties(*maybe_properties);
+
+    if (Base::major_v_ > 4) {
+      // element_id introduced in v5.0
+      Base::WriteString(std::to_string(id.AsInt()));
+    }
+    return {};
+  }
+
+  /// Writes the edge in the same format as Base::WriteEdge writes the result
+  /// of ToBoltEdge.
+  ///
+  /// @throw std::bad_alloc
+  storage::Result<void> WriteEdgeAccessor(const storage::EdgeAccessor &edge) {
+    auto maybe_properties = edge.Properties(view_);
+    if (maybe_properties.HasError()) return maybe_properties.GetError();
+
+    const auto id = communication::bolt::Id::FromUint(edge.Gid().AsUint());
+    const auto from = communication::bolt::Id::FromUint(edge.FromVertex().Gid().AsUint());
+    const auto to = communication::bolt::Id::FromUint(edge.ToVertex().Gid().AsUint());
+    const int struct_n = 5 + 3 * int(Base::major_v_ > 4);  // element_id introduced from v5
+    Base::WriteRAW(utils::UnderlyingCast(communication::bolt::Marker::TinyStruct) + struct_n);
+    Base::WriteRAW(utils::UnderlyingCast(communication::bolt::Signature::Relationship));
+    Base::WriteInt(id.AsInt());
+    Base::WriteInt(from.AsInt());
+    Base::WriteInt(to.AsInt());
+    Base::WriteString(db_->EdgeTypeToName(edge.EdgeType()));
+
+    WriteProperties(*maybe_properties);
+
+    if (Base::major_v_ > 4) {
+      // element_id, from_element_id and to_element_id introduced in v5.0
+      Base::WriteString(std::to_string(id.AsInt()));
+      Base::WriteString(std::to_string(from.AsInt()));
+      Base::WriteString(std::to_string(to.AsInt()));
+    }
+    return {};
+  }
+
+ private:
+  // ToBoltVertex and ToBoltEdge key the properties by name, so they are
+  // written in name order rather than in PropertyId order.
+  void WriteProperties(const std::map<storage::PropertyId, storage::PropertyValue> &properties) {
+    std::vector<std::pair<std::string, const storage::PropertyValue *>> named_properties;
+    named_properties.reserve(properties.size());
+    for (const auto &[property, value] : properties) {
+      named_properties.emplace_back(db_->PropertyToName(property), &value);
+    }
+    std::sort(named_properties.begin(), named_properties.end(),
+              [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+
+    Base::WriteTypeSize(named_properties.size(), communication::bolt::MarkerMap);
+    for (const auto &[name, value] : named_properties) {
+      Base::WriteString(name);
+      WritePropertyValue(*value);
+    }
+  }
+
+  const storage::Storage *db_;
+  storage::View view_;
+};
+
+}  // namespace memgraph::glue
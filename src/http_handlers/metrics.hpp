@@ -104,7 +104,7 @@ class MetricsService {
 
     for (auto i = 0; i < memgraph::metrics::CounterEnd(); i++) {
       event_counters.emplace_back(memgraph::metrics::GetCounterName(i), memgraph::metrics::GetCounterType(i),
-                                  memgraph::metrics::global_counters[i].load(std::memory_order_acquire));
+                                  memgraph::metrics::global_counters.Value(i));
     }
 
     return event_counters;
@@ -64,6 +64,7 @@
 #include "storage/v2/disk/storage.hpp"
 #include "storage/v2/inmemory/storage.hpp"
 #include "storage/v2/isolation_level.hpp"
+#include "storage/v2/property_string_dictionary.hpp"
 #include "storage/v2/storage.hpp"
 #include "storage/v2/view.hpp"
 #include "telemetry/telemetry.hpp"
@@ -102,6 +103,7 @@
 #include "communication/v2/server.hpp"
 #include "communication/v2/session.hpp"
 #include "dbms/session_context_handler.hpp"
+#include "glue/bolt_encoder.hpp"
 #include "glue/communication.hpp"
 
 #include "auth/auth.hpp"
@@ -207,15 +209,28 @@ DEFINE_VALIDATED_uint64(storage_wal_file_size_kib, memgraph::storage::Config::Du
 DEFINE_VALIDATED_uint64(storage_wal_file_flush_every_n_tx,
                         memgraph::storage::Config::Durability().wal_file_flush_every_n_tx,
                         "Issue a 'fsync' call after this amount of transactions are written to the "
-                        "WAL file. Set to 1 for fully synchronous operation.",
+                        "WAL file. The transaction that triggers the 'fsync' waits for it before its commit "
+                        "returns, but it is already visible to other transactions while waiting. Set to 1 for "
+                        "fully synchronous operation, where every transaction is synced before it becomes visible.",
                         FLAG_IN_RANGE(1, 1000000));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_wal_file_flush_interval_ms, 0,
+                        "Issue a 'fsync' call at least this often (in milliseconds) if any transactions were written "
+                        "to the WAL file since the last one. The 'fsync' is shared by all transactions written in "
+                        "the meantime. Set to 0 to sync only based on --storage-wal-file-flush-every-n-tx.",
+                        FLAG_IN_RANGE(0, 1000000));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_snapshot_on_exit, false, "Controls whether the storage creates another snapshot on exit.");
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_uint64(storage_items_per_batch, memgraph::storage::Config::Durability().items_per_batch,
               "The number of edges and vertices stored in a batch in a snapshot file.");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_property_string_interning_max_length, 0,
+              "String property values of up to this many bytes are stored once in a shared dictionary "
+              "instead of in every vertex and edge. Set to 0 to disable string interning.");
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_parallel_index_recovery, false,
             "Controls whether the index creation can be done in a multithreaded fashion.");
@@ -226,6 +241,14 @@ DEFINE_uint64(storage_recovery_thread_count,
                        memgraph::storage::Config::Durability().recovery_thread_count),
               "The number of threads used to recover persisted data from disk.");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_parallel_snapshot_creation, false,
+            "Controls whether the snapshot creation can be done in a multithreaded fashion.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_snapshot_thread_count, memgraph::storage::Config::Durability().snapshot_thread_count,
+              "The number of threads used to create snapshots.");
+
 #ifdef MG_ENTERPRISE
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_delete_on_drop, true,
@@ -249,6 +272,12 @@ DEFINE_uint32(
     stream_transaction_retry_interval, 500,
     "Retry interval in milliseconds when a stream transformation fails to commit because of conflicting transactions");
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(stream_transformation_batching, false,
+            "Set to true to execute consecutive queries with the same text returned by a stream transformation as a "
+            "single query which unwinds their parameters. The queries are then parsed and planned once per batch, but "
+            "the MATCH clauses of a query don't see the changes made for the previous rows of the same batch. Only "
+            "update queries without WITH, RETURN, UNION and subqueries are batched.");
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_string(kafka_bootstrap_servers, "",
               "List of default Kafka brokers as a comma separated list of broker host or host:port.");
 
@@ -275,6 +304,11 @@ DEFINE_double(query_execution_timeout_sec, 600,
               "Maximum allowed query execution time. Queries exceeding this "
               "limit will be aborted. Value of 0 means no limit.");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_parallel_scan_threads, 0,
+              "Number of threads used to scan and aggregate vertices of read-only queries on in-memory storage. "
+              "Values of 0 and 1 disable parallel scans.");
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_uint64(replication_replica_check_frequency_sec, 1,
               "The time duration between two replica checks/pings. If < 1, replicas will NOT be checked at all. NOTE: "
@@ -349,6 +383,63 @@ int64_t GetMemoryLimit() {
 }
 }  // namespace
 
+namespace {
+inline constexpr std::array disk_compression_mappings{
+    std::pair{"NONE"sv, memgraph::storage::Config::DiskConfig::Compression::NONE},
+    std::pair{"LZ4"sv, memgraph::storage::Config::DiskConfig::Compression::LZ4},
+    std::pair{"ZSTD"sv, memgraph::storage::Config::DiskConfig::Compression::ZSTD}};
+
+const std::string disk_compression_help_string =
+    fmt::format("Compression of the on-disk storage data files. ZSTD also compresses the RocksDB WAL. "
+                "Allowed values: {}",
+                memgraph::utils::GetAllowedEnumValuesString(disk_compression_mappings));
+}  // namespace
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_string(storage_disk_compression, "NONE", disk_compression_help_string.c_str(), {
+  if (const auto result = memgraph::utils::IsValidEnumValueString(value, disk_compression_mappings);
+      result.HasError()) {
+    const auto error = result.GetError();
+    switch (error) {
+      case memgraph::utils::ValidationError::EmptyValue: {
+        std::cout << "Disk compression cannot be empty." << std::endl;
+        break;
+      }
+      case memgraph::utils::ValidationError::InvalidValue: {
+        std::cout << "Invalid value for disk compression. Allowed values: "
+                  << memgraph::utils::GetAllowedEnumValuesString(disk_compression_mappings) << std::endl;
+        break;
+      }
+    }
+    return false;
+  }
+
+  return true;
+});
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_disk_block_cache_size_mib, memgraph::storage::Config::DiskConfig().block_cache_size_mib,
+              "Size of the block cache shared by all of the on-disk storage RocksDB instances (in MiB). There is one "
+              "such cache in the process, shared by all of the databases. Set to 0 to use the RocksDB default cache "
+              "of each instance.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_disk_bloom_filter_bits_per_key, memgraph::storage::Config::DiskConfig().bloom_filter_bits_per_key,
+              "Bits per key of the bloom filters of the on-disk storage. Set to 0 to disable the bloom filters.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_disk_use_direct_io, false,
+            "Controls whether the on-disk storage bypasses the page cache for reads, flushes and compactions.");
+
+namespace {
+memgraph::storage::Config::DiskConfig::Compression ParseDiskCompression() {
+  const auto compression = memgraph::utils::StringToEnum<memgraph::storage::Config::DiskConfig::Compression>(
+      FLAGS_storage_disk_compression, disk_compression_mappings);
+  MG_ASSERT(compression, "Invalid disk compression");
+  return *compression;
+}
+}  // namespace
+
 namespace {
 std::vector<std::filesystem::path> query_modules_directories;
 }  // namespace
@@ -856,20 +947,21 @@ class SessionHL final : public memgraph::communication::bolt::Session<memgraph::
   }
 #endif
 
-  /// Wrapper around TEncoder which converts TypedValue to Value
-  /// before forwarding the calls to original TEncoder.
+  /// Wrapper around TEncoder which encodes TypedValue straight into Bolt
+  /// records before forwarding them to the original TEncoder.
   class TypedValueResultStream {
    public:
     TypedValueResultStream(TEncoder *encoder, memgraph::query::InterpreterContext *ic)
-        : encoder_(encoder), interpreter_context_(ic) {}
+        : encoder_(encoder), record_encoder_(record_buffer_, *ic->db, memgraph::storage::View::NEW) {
+      record_encoder_.UpdateVersion(encoder_->Version());
+    }
 
     void Result(const std::vector<memgraph::query::TypedValue> &values) {
-      std::vector<memgraph::communication::bolt::Value> decoded_values;
-      decoded_values.reserve(values.size());
+      record_buffer_.Clear();
       for (const auto &v : values) {
-        auto maybe_value = memgraph::glue::ToBoltValue(v, *interpreter_context_->db, memgraph::storage::View::NEW);
-        if (maybe_value.HasError()) {
-          switch (maybe_value.GetError()) {
+        auto maybe_written = record_encoder_.WriteTypedValue(v);
+        if (maybe_written.HasError()) {
+          switch (maybe_written.GetError()) {
             case memgraph::storage::Error::DELETED_OBJECT:
               throw memgraph::communication::bolt::ClientError("Returning a deleted object as a result.");
             case memgraph::storage::Error::NONEXISTENT_OBJECT:
@@ -880,15 +972,16 @@ class SessionHL final : public memgraph::communication::bolt::Session<memgraph::
               throw memgraph::communication::bolt::ClientError("Unexpected storage error when streaming results.");
           }
         }
-        decoded_values.emplace_back(std::move(*maybe_value));
       }
-      encoder_->MessageRecord(decoded_values);
+      encoder_->MessageRecord(values.size(), record_buffer_.data(), record_buffer_.size());
     }
 
    private:
     TEncoder *encoder_;
-    // NOTE: Needed only for ToBoltValue conversions
-    memgraph::query::InterpreterContext *interpreter_context_;
+    // A record is encoded into the buffer first, so that nothing is sent when
+    // the encoding of one of its values fails.
+    memgraph::glue::BoltRecordBuffer record_buffer_;
+    memgraph::glue::TypedValueEncoder<memgraph::glue::BoltRecordBuffer> record_encoder_;
   };
 
 #ifdef MG_ENTERPRISE
@@ -1097,6 +1190,10 @@ int main(int argc, char **argv) {
   // End enterprise features initialization
 #endif
 
+  // Strings have to be interned already when the data is recovered.
+  memgraph::storage::PropertyStringDictionary::Global().SetMaxLength(
+      FLAGS_storage_property_string_interning_max_length);
+
   // Main storage and execution engines initialization
   memgraph::storage::Config db_config{
       .gc = {.type = memgraph::storage::Config::Gc::Type::PERIODIC,
@@ -1107,11 +1204,14 @@ int main(int argc, char **argv) {
                      .snapshot_retention_count = FLAGS_storage_snapshot_retention_count,
                      .wal_file_size_kibibytes = FLAGS_storage_wal_file_size_kib,
                      .wal_file_flush_every_n_tx = FLAGS_storage_wal_file_flush_every_n_tx,
+                     .wal_file_flush_interval = std::chrono::milliseconds(FLAGS_storage_wal_file_flush_interval_ms),
                      .snapshot_on_exit = FLAGS_storage_snapshot_on_exit,
                      .restore_replication_state_on_startup = FLAGS_replication_restore_state_on_startup,
                      .items_per_batch = FLAGS_storage_items_per_batch,
                      .recovery_thread_count = FLAGS_storage_recovery_thread_count,
-                     .allow_parallel_index_creation = FLAGS_storage_parallel_index_recovery},
+                     .allow_parallel_index_creation = FLAGS_storage_parallel_index_recovery,
+                     .allow_parallel_snapshot_creation = FLAGS_storage_parallel_snapshot_creation,
+                     .snapshot_thread_count = FLAGS_storage_snapshot_thread_count},
       .transaction = {.isolation_level = ParseIsolationLevel()},
       .disk = {.main_storage_directory = FLAGS_data_directory + "/rocksdb_main_storage",
                .label_index_directory = FLAGS_data_directory + "/rocksdb_label_index",
@@ -1120,7 +1220,11 @@ int main(int argc, char **argv) {
                .name_id_mapper_directory = FLAGS_data_directory + "/rocksdb_name_id_mapper",
                .id_name_mapper_directory = FLAGS_data_directory + "/rocksdb_id_name_mapper",
                .durability_directory = FLAGS_data_directory + "/rocksdb_durability",
-               .wal_directory = FLAGS_data_directory + "/rocksdb_wal"}};
+               .wal_directory = FLAGS_data_directory + "/rocksdb_wal",
+               .compression = ParseDiskCompression(),
+               .block_cache_size_mib = FLAGS_storage_disk_block_cache_size_mib,
+               .bloom_filter_bits_per_key = FLAGS_storage_disk_bloom_filter_bits_per_key,
+               .use_direct_io = FLAGS_storage_disk_use_direct_io}};
   if (FLAGS_storage_snapshot_interval_sec == 0) {
     if (FLAGS_storage_wal_enabled) {
       LOG_FATAL(
@@ -1142,13 +1246,14 @@ int main(int argc, char **argv) {
 
   // Default interpreter configuration
   memgraph::query::InterpreterConfig interp_config{
-      .query = {.allow_load_csv = FLAGS_allow_load_csv},
+      .query = {.allow_load_csv = FLAGS_allow_load_csv, .parallel_scan_threads = FLAGS_query_parallel_scan_threads},
       .execution_timeout_sec = FLAGS_query_execution_timeout_sec,
       .replication_replica_check_frequency = std::chrono::seconds(FLAGS_replication_replica_check_frequency_sec),
       .default_kafka_bootstrap_servers = FLAGS_kafka_bootstrap_servers,
       .default_pulsar_service_url = FLAGS_pulsar_service_url,
       .stream_transaction_conflict_retries = FLAGS_stream_transaction_conflict_retries,
-      .stream_transaction_retry_interval = std::chrono::milliseconds(FLAGS_stream_transaction_retry_interval)};
+      .stream_transaction_retry_interval = std::chrono::milliseconds(FLAGS_stream_transaction_retry_interval),
+      .stream_transformation_batching = FLAGS_stream_transformation_batching};
 
   auto auth_glue =
       [flag = FLAGS_auth_user_or_role_name_regex](
@@ -1268,8 +1373,7 @@ int main(int argc, char **argv) {
     telemetry->AddCollector("event_counters", []() -> nlohmann::json {
       nlohmann::json ret;
       for (size_t i = 0; i < memgraph::metrics::CounterEnd(); ++i) {
-        ret[memgraph::metrics::GetCounterName(i)] =
-            memgraph::metrics::global_counters[i].load(std::memory_order_relaxed);
+        ret[memgraph::metrics::GetCounterName(i)] = memgraph::metrics::global_counters.Value(i);
       }
       return ret;
     });
@@ -11,12 +11,16 @@
 
 #pragma once
 #include <chrono>
+#include <cstdint>
 #include <string>
 
 namespace memgraph::query {
 struct InterpreterConfig {
   struct Query {
     bool allow_load_csv{true};
+    // Number of threads used by scans below aggregations of read-only
+    // queries. Values below 2 disable parallel scans.
+    uint64_t parallel_scan_threads{0};
   } query;
 
   // The default execution timeout is 10 minutes.
@@ -28,5 +32,8 @@ struct InterpreterConfig {
   std::string default_pulsar_service_url;
   uint32_t stream_transaction_conflict_retries;
   std::chrono::milliseconds stream_transaction_retry_interval;
+  // Execute consecutive stream transformation results with the same query as
+  // a single query which unwinds their parameters.
+  bool stream_transformation_batching{false};
 };
 }  // namespace memgraph::query
@@ -86,6 +86,9 @@ struct ExecutionContext {
   TriggerContextCollector *trigger_context_collector{nullptr};
   FrameChangeCollector *frame_change_collector{nullptr};
   std::shared_ptr<utils::AsyncTimer> timer;
+  /// Number of threads which may scan and aggregate vertices below an
+  /// Aggregate. Values below 2 keep the execution on the calling thread.
+  uint64_t parallel_scan_threads{0};
 #ifdef MG_ENTERPRISE
   std::unique_ptr<FineGrainedAuthChecker> auth_checker{nullptr};
 #endif
@@ -17,6 +17,7 @@
 #include <cppitertools/imap.hpp>
 
 #include "query/exceptions.hpp"
+#include "query/procedure/csr_projection.hpp"
 #include "storage/v2/edge_accessor.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_value.hpp"
@@ -324,6 +325,7 @@ class VerticesIterable final {
 
 class DbAccessor final {
   storage::Storage::Accessor *accessor_;
+  procedure::CsrProjectionCache csr_projections_;
 
  public:
   explicit DbAccessor(storage::Storage::Accessor *accessor) : accessor_(accessor) {}
@@ -438,6 +440,10 @@ class DbAccessor final {
 
   void AdvanceCommand() { accessor_->AdvanceCommand(); }
 
+  uint64_t GetCommandId() const { return accessor_->GetCommandId(); }
+
+  procedure::CsrProjectionCache &CsrProjections() { return csr_projections_; }
+
   utils::BasicResult<storage::StorageDataManipulationError, void> Commit() { return accessor_->Commit(); }
 
   void Abort() { accessor_->Abort(); }
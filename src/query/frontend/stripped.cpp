@@ -13,9 +13,11 @@
 
 #include <cctype>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "query/exceptions.hpp"
@@ -46,9 +48,12 @@ StrippedQuery::StrippedQuery(const std::string &query) : original_(query) {
     SPACE
   };
 
-  std::vector<std::pair<Token, std::string>> tokens;
-  std::string unstripped_chunk;
-  for (int i = 0; i < static_cast<int>(original_.size());) {
+  // Tokens refer to the text of `original_`, which isn't modified anymore, so
+  // they aren't copied.
+  const std::string_view original = original_;
+  std::vector<std::pair<Token, std::string_view>> tokens;
+  std::string_view unstripped_chunk;
+  for (int i = 0; i < static_cast<int>(original.size());) {
     Token token = Token::UNMATCHED;
     int len = 0;
     auto update = [&](int new_len, Token new_token) {
@@ -57,19 +62,36 @@ StrippedQuery::StrippedQuery(const std::string &query) : original_(query) {
         token = new_token;
       }
     };
-    update(MatchKeyword(i), Token::KEYWORD);
-    update(MatchSpecial(i), Token::SPECIAL);
-    update(MatchString(i), Token::STRING);
-    update(MatchDecimalInt(i), Token::INT);
-    update(MatchOctalInt(i), Token::INT);
-    update(MatchHexadecimalInt(i), Token::INT);
-    update(MatchReal(i), Token::REAL);
-    update(MatchParameter(i), Token::PARAMETER);
-    update(MatchEscapedName(i), Token::ESCAPED_NAME);
-    update(MatchUnescapedName(i), Token::UNESCAPED_NAME);
-    update(MatchWhitespaceAndComments(i), Token::SPACE);
+    // Most tokens start with an ASCII letter, digit or whitespace, and only a
+    // few of the matchers can match those, so the other matchers are skipped.
+    // The matchers are still called in the same order, because the first one
+    // wins when several of them match the same length.
+    const auto first = static_cast<unsigned char>(original[i]);
+    if (('a' <= first && first <= 'z') || ('A' <= first && first <= 'Z') || first == '_') {
+      update(MatchKeyword(i), Token::KEYWORD);
+      update(MatchUnescapedName(i), Token::UNESCAPED_NAME);
+    } else if ('0' <= first && first <= '9') {
+      update(MatchDecimalInt(i), Token::INT);
+      update(MatchOctalInt(i), Token::INT);
+      update(MatchHexadecimalInt(i), Token::INT);
+      update(MatchReal(i), Token::REAL);
+    } else if (first < 0x80 && kSpaceParts[first]) {
+      update(MatchWhitespaceAndComments(i), Token::SPACE);
+    } else {
+      update(MatchKeyword(i), Token::KEYWORD);
+      update(MatchSpecial(i), Token::SPECIAL);
+      update(MatchString(i), Token::STRING);
+      update(MatchDecimalInt(i), Token::INT);
+      update(MatchOctalInt(i), Token::INT);
+      update(MatchHexadecimalInt(i), Token::INT);
+      update(MatchReal(i), Token::REAL);
+      update(MatchParameter(i), Token::PARAMETER);
+      update(MatchEscapedName(i), Token::ESCAPED_NAME);
+      update(MatchUnescapedName(i), Token::UNESCAPED_NAME);
+      update(MatchWhitespaceAndComments(i), Token::SPACE);
+    }
     if (token == Token::UNMATCHED) throw LexingException("Invalid query.");
-    tokens.emplace_back(token, original_.substr(i, len));
+    tokens.emplace_back(token, original.substr(i, len));
     i += len;
 
     // If we notice execute, we possibly create a trigger which has defined statements.
@@ -88,24 +110,30 @@ StrippedQuery::StrippedQuery(const std::string &query) : original_(query) {
       // trigger-name (5th element) can also be "execute" so we verify that the size is larger than 5
       if (token_span.size() > 5 && utils::IEquals(token_span[0].second, "create") &&
           utils::IEquals(token_span[2].second, "trigger")) {
-        unstripped_chunk = original_.substr(i);
+        unstripped_chunk = original.substr(i);
         break;
       }
     }
   }
 
-  std::vector<std::string> token_strings;
+  // The stripped query is built as the tokens are converted, with a single
+  // space between every two tokens.
+  query_.reserve(original.size());
+  int num_stripped_tokens = 0;
+  auto append_token = [this, &num_stripped_tokens](std::string_view token) {
+    if (num_stripped_tokens > 0) query_ += ' ';
+    query_ += token;
+    ++num_stripped_tokens;
+  };
+
   // A helper function that stores literal and its token position in a
   // literals_. In stripped query text literal is replaced with a new_value.
   // new_value can be any value that is lexed as a literal.
-  auto replace_stripped = [this, &token_strings](int position, const auto &value, const std::string &new_value) {
+  auto replace_stripped = [this, &append_token](int position, const auto &value, const std::string &new_value) {
     literals_.Add(position, storage::PropertyValue(value));
-    token_strings.push_back(new_value);
+    append_token(new_value);
   };
 
-  // Copy original tokens because we need to use original case in named
-  // expressions and keywords in tokens will be lowercased in the next loop.
-  auto original_tokens = tokens;
   // For every token in original query remember token index in stripped query.
   std::vector<int> position_mapping(tokens.size(), -1);
 
@@ -116,7 +144,7 @@ StrippedQuery::StrippedQuery(const std::string &query) : original_(query) {
 
     // We need to shift token index for every parameter since antlr's parser
     // thinks of parameter as two tokens.
-    int token_index = token_strings.size() + parameters_.size();
+    int token_index = num_stripped_tokens + parameters_.size();
     switch (token.first) {
       case Token::UNMATCHED:
         LOG_FATAL("Shouldn't happen");
@@ -128,28 +156,28 @@ StrippedQuery::StrippedQuery(const std::string &query) : original_(query) {
         } else if (utils::IEquals(token.second, "false")) {
           replace_stripped(token_index, false, kStrippedBooleanToken);
         } else {
-          token_strings.push_back(token.second);
+          append_token(token.second);
         }
       } break;
       case Token::SPACE:
         break;
       case Token::STRING:
-        replace_stripped(token_index, ParseStringLiteral(token.second), kStrippedStringToken);
+        replace_stripped(token_index, ParseStringLiteral(std::string(token.second)), kStrippedStringToken);
         break;
       case Token::INT:
-        replace_stripped(token_index, ParseIntegerLiteral(token.second), kStrippedIntToken);
+        replace_stripped(token_index, ParseIntegerLiteral(std::string(token.second)), kStrippedIntToken);
         break;
       case Token::REAL:
-        replace_stripped(token_index, ParseDoubleLiteral(token.second), kStrippedDoubleToken);
+        replace_stripped(token_index, ParseDoubleLiteral(std::string(token.second)), kStrippedDoubleToken);
         break;
       case Token::SPECIAL:
       case Token::ESCAPED_NAME:
       case Token::UNESCAPED_NAME:
-        token_strings.push_back(token.second);
+        append_token(token.second);
         break;
       case Token::PARAMETER:
-        parameters_[token_index] = ParseParameter(token.second);
-        token_strings.push_back(token.second);
+        parameters_[token_index] = ParseParameter(std::string(token.second));
+        append_token(token.second);
         break;
     }
 
@@ -159,17 +187,16 @@ StrippedQuery::StrippedQuery(const std::string &query) : original_(query) {
   }
 
   if (!unstripped_chunk.empty()) {
-    token_strings.push_back(std::move(unstripped_chunk));
+    append_token(unstripped_chunk);
   }
 
-  query_ = utils::Join(token_strings, " ");
   hash_ = utils::Fnv(query_);
 
   auto it = tokens.begin();
   while (it != tokens.end()) {
     // Store nonaliased named expressions in returns in named_exprs_.
     it = std::find_if(it, tokens.end(),
-                      [](const std::pair<Token, std::string> &a) { return utils::IEquals(a.second, "return"); });
+                      [](const std::pair<Token, std::string_view> &a) { return utils::IEquals(a.second, "return"); });
     // There is no RETURN so there is nothing to do here.
     if (it == tokens.end()) return;
     // Skip RETURN;
@@ -233,9 +260,7 @@ StrippedQuery::StrippedQuery(const std::string &query) : original_(query) {
         // Named expression is not aliased. Save string disregarding leading and
         // trailing whitespaces.
         std::string s;
-        auto begin_token = it - tokens.begin() + original_tokens.begin();
-        auto end_token = last_non_space - tokens.begin() + original_tokens.begin() + 1;
-        for (auto kt = begin_token; kt != end_token; ++kt) {
+        for (auto kt = it; kt != last_non_space + 1; ++kt) {
           s += kt->second;
         }
         named_exprs_[position_mapping[it - tokens.begin()]] = s;
@@ -336,7 +361,12 @@ int StrippedQuery::MatchSpecial(int start) const { return kSpecialTokens.Match(o
 int StrippedQuery::MatchString(int start) const {
   if (original_[start] != '"' && original_[start] != '\'') return 0;
   char start_char = original_[start];
+  // Only quotes and escapes have to be looked at, and strcspn skips the rest
+  // of the string body with vector instructions in the common C libraries.
+  const char stop_chars[] = {start_char, '\\', '\0'};
   for (auto *p = original_.data() + start + 1; *p; ++p) {
+    p += strcspn(p, stop_chars);
+    if (!*p) break;
     if (*p == start_char) return p - (original_.data() + start) + 1;
     if (*p == '\\') {
       ++p;
@@ -467,6 +497,13 @@ int StrippedQuery::MatchUnescapedName(int start) const {
   }
   i += got.second;
   while (i < static_cast<int>(original_.size())) {
+    // ASCII characters don't have to be decoded.
+    const auto c = static_cast<unsigned char>(original_[i]);
+    if (c < 0x80) {
+      if (!kUnescapedNameAllowedParts[c]) break;
+      ++i;
+      continue;
+    }
     got = GetFirstUtf8SymbolCodepoint(original_.data() + i);
     if (got.first >= lexer_constants::kBitsetSize || !kUnescapedNameAllowedParts[got.first]) {
       break;
@@ -486,6 +523,11 @@ int StrippedQuery::MatchWhitespaceAndComments(int start) const {
   int comment_position = -1;
   while (i < len) {
     if (state == State::OUT) {
+      const auto c = static_cast<unsigned char>(original_[i]);
+      if (c < 0x80 && kSpaceParts[c]) {
+        ++i;
+        continue;
+      }
       auto got = GetFirstUtf8SymbolCodepoint(original_.data() + i);
       if (got.first < lexer_constants::kBitsetSize && kSpaceParts[got.first]) {
         i += got.second;
@@ -520,7 +562,11 @@ int StrippedQuery::MatchWhitespaceAndComments(int start) const {
         ++i;
       }
     } else if (state == State::IN_BLOCK_COMMENT) {
-      if (i + 1 < len && original_[i] == '*' && original_[i + 1] == '/') {
+      // Jump to the next '*', since only it can end the comment.
+      const auto *star = static_cast<const char *>(memchr(original_.data() + i, '*', len - i));
+      if (!star) {
+        i = len;
+      } else if (i = star - original_.data(); i + 1 < len && original_[i + 1] == '/') {
         i += 2;
         state = State::OUT;
       } else {
@@ -35,6 +35,7 @@ class Frame {
   const TypedValue &at(const Symbol &symbol) const { return elems_.at(symbol.position()); }
 
   auto &elems() { return elems_; }
+  const auto &elems() const { return elems_; }
 
   utils::MemoryResource *GetMemoryResource() const { return elems_.get_allocator().GetMemoryResource(); }
 
@@ -42,4 +43,60 @@ class Frame {
   utils::pmr::vector<TypedValue> elems_;
 };
 
+/// A block of rows exchanged between cursors pulled in batches.
+///
+/// Each row is a complete Frame, so symbols of a row are read and written in
+/// the same way as with a single frame. Rows are kept between pulls and
+/// reused, so the frames are allocated only once.
+class FrameBatch {
+ public:
+  static constexpr size_t kDefaultCapacity = 1024;
+
+  FrameBatch(int64_t frame_size, utils::MemoryResource *memory, size_t capacity = kDefaultCapacity)
+      : frame_size_(frame_size), memory_(memory), capacity_(capacity) {
+    MG_ASSERT(capacity > 0);
+    rows_.reserve(capacity);
+  }
+
+  size_t size() const { return size_; }
+  size_t capacity() const { return capacity_; }
+  bool empty() const { return size_ == 0; }
+  bool full() const { return size_ == capacity_; }
+
+  Frame &operator[](size_t row) { return rows_[row]; }
+  const Frame &operator[](size_t row) const { return rows_[row]; }
+
+  /// Appends a copy of the given frame and returns the new row.
+  Frame &Append(const Frame &frame) {
+    DMG_ASSERT(!full(), "Appending to a full batch.");
+    if (size_ == rows_.size()) rows_.emplace_back(frame_size_, memory_);
+    auto &row = rows_[size_++];
+    row.elems() = frame.elems();
+    return row;
+  }
+
+  /// Removes the rows for which `keep(row)` is false. The order of the
+  /// remaining rows is preserved.
+  template <typename TKeep>
+  void KeepIf(TKeep keep) {
+    size_t kept = 0;
+    for (size_t row = 0; row < size_; ++row) {
+      if (!keep(row)) continue;
+      if (kept != row) rows_[kept].elems().swap(rows_[row].elems());
+      ++kept;
+    }
+    size_ = kept;
+  }
+
+  void Clear() { size_ = 0; }
+
+ private:
+  int64_t frame_size_;
+  utils::MemoryResource *memory_;
+  size_t capacity_;
+  size_t size_{0};
+  // Rows past `size_` are unused, but keep their allocations.
+  std::vector<Frame> rows_;
+};
+
 }  // namespace memgraph::query
@@ -1168,7 +1168,7 @@ struct PullPlan {
                     std::shared_ptr<utils::AsyncTimer> tx_timer,
                     TriggerContextCollector *trigger_context_collector = nullptr,
                     std::optional<size_t> memory_limit = {}, bool use_monotonic_memory = true,
-                    FrameChangeCollector *frame_change_collector_ = nullptr);
+                    FrameChangeCollector *frame_change_collector_ = nullptr, bool is_read_only = false);
 
   std::optional<plan::ProfilingStatsWithTotalTime> Pull(AnyStream *stream, std::optional<int> n,
                                                         const std::vector<Symbol> &output_symbols,
@@ -1207,7 +1207,7 @@ PullPlan::PullPlan(const std::shared_ptr<CachedPlan> plan, const Parameters &par
                    std::optional<std::string> username, std::atomic<TransactionStatus> *transaction_status,
                    std::shared_ptr<utils::AsyncTimer> tx_timer, TriggerContextCollector *trigger_context_collector,
                    const std::optional<size_t> memory_limit, bool use_monotonic_memory,
-                   FrameChangeCollector *frame_change_collector)
+                   FrameChangeCollector *frame_change_collector, bool is_read_only)
     : plan_(plan),
       cursor_(plan->plan().MakeCursor(execution_memory)),
       frame_(plan->symbol_table().max_position(), execution_memory),
@@ -1239,6 +1239,12 @@ PullPlan::PullPlan(const std::shared_ptr<CachedPlan> plan, const Parameters &par
   ctx_.is_profile_query = is_profile_query;
   ctx_.trigger_context_collector = trigger_context_collector;
   ctx_.frame_change_collector = frame_change_collector;
+  // Parts of the plan are executed on multiple threads only when the query
+  // doesn't modify the graph and the storage allows concurrent reads within a
+  // single transaction.
+  if (is_read_only && dba && dba->GetStorageMode() != storage::StorageMode::ON_DISK_TRANSACTIONAL) {
+    ctx_.parallel_scan_threads = interpreter_context->config.query.parallel_scan_threads;
+  }
 }
 
 std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *stream, std::optional<int> n,
@@ -1595,7 +1601,8 @@ PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string,
       std::make_shared<PullPlan>(plan, parsed_query.parameters, false, dba, interpreter_context, execution_memory,
                                  StringPointerToOptional(username), transaction_status, std::move(tx_timer),
                                  trigger_context_collector, memory_limit, use_monotonic_memory,
-                                 frame_change_collector->IsTrackingValues() ? frame_change_collector : nullptr);
+                                 frame_change_collector->IsTrackingValues() ? frame_change_collector : nullptr,
+                                 rw_type_checker.type == RWType::R);
   return PreparedQuery{std::move(header), std::move(parsed_query.required_privileges),
                        [pull_plan = std::move(pull_plan), output_symbols = std::move(output_symbols), summary](
                            AnyStream *stream, std::optional<int> n) -> std::optional<QueryHandlerResult> {
@@ -2909,18 +2916,28 @@ PreparedQuery PrepareInfoQuery(ParsedQuery parsed_query, bool in_explicit_transa
       };
       break;
     case InfoQuery::InfoType::INDEX:
-      header = {"index type", "label", "property"};
+      header = {"index type", "label", "property", "progress"};
       handler = [interpreter_context] {
         auto *db = interpreter_context->db.get();
         auto info = db->ListAllIndices();
         std::vector<std::vector<TypedValue>> results;
-        results.reserve(info.label.size() + info.label_property.size());
+        results.reserve(info.label.size() + info.label_property.size() + info.label_populating.size() +
+                        info.label_property_populating.size());
         for (const auto &item : info.label) {
-          results.push_back({TypedValue("label"), TypedValue(db->LabelToName(item)), TypedValue()});
+          results.push_back({TypedValue("label"), TypedValue(db->LabelToName(item)), TypedValue(), TypedValue(1.0)});
         }
         for (const auto &item : info.label_property) {
           results.push_back({TypedValue("label+property"), TypedValue(db->LabelToName(item.first)),
-                             TypedValue(db->PropertyToName(item.second))});
+                             TypedValue(db->PropertyToName(item.second)), TypedValue(1.0)});
+        }
+        // Indices which are still being built aren't used by the planner yet.
+        for (const auto &[label, progress] : info.label_populating) {
+          results.push_back(
+              {TypedValue("label"), TypedValue(db->LabelToName(label)), TypedValue(), TypedValue(progress)});
+        }
+        for (const auto &[label_property, progress] : info.label_property_populating) {
+          results.push_back({TypedValue("label+property"), TypedValue(db->LabelToName(label_property.first)),
+                             TypedValue(db->PropertyToName(label_property.second)), TypedValue(progress)});
         }
         return std::pair{results, QueryHandlerResult::NOTHING};
       };
@@ -84,6 +84,7 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     static constexpr double kForeach{1.0};
     static constexpr double kUnion{1.0};
     static constexpr double kSubquery{1.0};
+    static constexpr double kHashJoin{1.0};
   };
 
   struct CardParam {
@@ -281,6 +282,20 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     return false;
   }
 
+  bool PreVisit(HashJoin &op) override {
+    // Each branch is pulled only once, so their costs add up instead of
+    // getting multiplied like with a nested scan. Every row from both
+    // branches is then either inserted into the hash table or probed once.
+    auto [left_cost, left_cardinality] = EstimateCostAndCardinalityOnBranch(&op.left_op_);
+    auto [right_cost, right_cardinality] = EstimateCostAndCardinalityOnBranch(&op.right_op_);
+
+    cost_ += cardinality_ * (left_cost + right_cost + CostParam::kHashJoin * (left_cardinality + right_cardinality));
+    // The join condition filters the product the same way a Filter would.
+    cardinality_ *= left_cardinality * right_cardinality * CardParam::kFilter;
+
+    return false;
+  }
+
   bool PostVisit(Produce &op) override {
     auto scope = Scope();
 
@@ -345,6 +360,12 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     return cost_estimator.cost();
   }
 
+  std::pair<double, double> EstimateCostAndCardinalityOnBranch(std::shared_ptr<LogicalOperator> *branch) {
+    CostEstimator<TDbAccessor> cost_estimator(db_accessor_, table_, parameters, scopes_.back());
+    (*branch)->Accept(cost_estimator);
+    return {cost_estimator.cost(), cost_estimator.cardinality()};
+  }
+
   double EstimateCostOnBranch(std::shared_ptr<LogicalOperator> *branch, Scope scope) {
     CostEstimator<TDbAccessor> cost_estimator(db_accessor_, table_, parameters, scope);
     (*branch)->Accept(cost_estimator);
@@ -12,13 +12,18 @@
 #include "query/plan/operator.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <cstdint>
+#include <deque>
+#include <exception>
 #include <limits>
+#include <mutex>
 #include <optional>
 #include <queue>
 #include <random>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
@@ -30,6 +35,7 @@
 #include "query/common.hpp"
 #include "spdlog/spdlog.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "csv/parsing.hpp"
 #include "license/license.hpp"
 #include "query/auth_checker.hpp"
@@ -65,6 +71,7 @@
 #include "utils/readable_size.hpp"
 #include "utils/string.hpp"
 #include "utils/temporal.hpp"
+#include "utils/thread.hpp"
 #include "utils/typeinfo.hpp"
 
 // macro for the default implementation of LogicalOperator::Accept
@@ -124,6 +131,7 @@ extern const Event ForeachOperator;
 extern const Event EmptyResultOperator;
 extern const Event EvaluatePatternFilterOperator;
 extern const Event ApplyOperator;
+extern const Event HashJoinOperator;
 }  // namespace memgraph::metrics
 
 namespace memgraph::query::plan {
@@ -168,6 +176,12 @@ inline void AbortCheck(ExecutionContext const &context) {
 
 #define SCOPED_PROFILE_OP(name) ScopedProfile profile{ComputeProfilingKey(this), name, &context};
 
+bool Cursor::PullBatch(Frame &frame, FrameBatch &batch, ExecutionContext &context) {
+  batch.Clear();
+  while (!batch.full() && Pull(frame, context)) batch.Append(frame);
+  return !batch.empty();
+}
+
 bool Once::OnceCursor::Pull(Frame &, ExecutionContext &context) {
   SCOPED_PROFILE_OP("Once");
 
@@ -461,6 +475,35 @@ class ScanAllCursor : public Cursor {
     return true;
   }
 
+  bool PullBatch(Frame &frame, FrameBatch &batch, ExecutionContext &context) override {
+#ifdef MG_ENTERPRISE
+    // Vertices are checked against fine grained privileges one at a time.
+    if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker) {
+      return Cursor::PullBatch(frame, batch, context);
+    }
+#endif
+    SCOPED_PROFILE_OP(op_name_);
+
+    AbortCheck(context);
+
+    batch.Clear();
+    while (!batch.full()) {
+      if (!vertices_ || vertices_it_.value() == vertices_.value().end()) {
+        if (!input_cursor_->Pull(frame, context)) break;
+        auto next_vertices = get_vertices_(frame, context);
+        if (!next_vertices) continue;
+        vertices_.emplace(std::move(next_vertices.value()));
+        vertices_it_.emplace(vertices_.value().begin());
+        continue;
+      }
+      // The rest of the row comes from the input pulled into the frame.
+      auto &row = batch.Append(frame);
+      row[output_symbol_] = *vertices_it_.value();
+      ++vertices_it_.value();
+    }
+    return !batch.empty();
+  }
+
 #ifdef MG_ENTERPRISE
   bool FindNextVertex(const ExecutionContext &context) {
     while (vertices_it_.value() != vertices_.value().end()) {
@@ -790,6 +833,50 @@ bool Expand::ExpandCursor::Pull(Frame &frame, ExecutionContext &context) {
   }
 }
 
+bool Expand::ExpandCursor::PullBatch(Frame &frame, FrameBatch &batch, ExecutionContext &context) {
+#ifdef MG_ENTERPRISE
+  // Edges are checked against fine grained privileges one at a time.
+  if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker) {
+    return Cursor::PullBatch(frame, batch, context);
+  }
+#endif
+  SCOPED_PROFILE_OP("Expand");
+
+  if (!input_batch_) input_batch_.emplace(frame.elems().size(), frame.GetMemoryResource());
+
+  // Each expanded edge is a copy of the input row it was expanded from.
+  auto append_row = [&](const EdgeAccessor &edge, EdgeAtom::Direction direction) {
+    auto &row = batch.Append((*input_batch_)[input_row_ - 1]);
+    row[self_.common_.edge_symbol] = edge;
+    if (self_.common_.existing_node) return;
+    row[self_.common_.node_symbol] = direction == EdgeAtom::Direction::IN ? edge.From() : edge.To();
+  };
+
+  batch.Clear();
+  while (!batch.full()) {
+    if (in_edges_ && *in_edges_it_ != in_edges_->end()) {
+      append_row(*(*in_edges_it_)++, EdgeAtom::Direction::IN);
+      continue;
+    }
+
+    if (out_edges_ && *out_edges_it_ != out_edges_->end()) {
+      auto edge = *(*out_edges_it_)++;
+      // Cycles were already expanded with the incoming edges.
+      if (self_.common_.direction == EdgeAtom::Direction::BOTH && edge.IsCycle()) continue;
+      append_row(edge, EdgeAtom::Direction::OUT);
+      continue;
+    }
+
+    if (input_row_ == input_batch_->size()) {
+      AbortCheck(context);
+      input_row_ = 0;
+      if (!input_cursor_->PullBatch(frame, *input_batch_, context)) break;
+    }
+    InitEdgesFromRow((*input_batch_)[input_row_++], context);
+  }
+  return !batch.empty();
+}
+
 void Expand::ExpandCursor::Shutdown() { input_cursor_->Shutdown(); }
 
 void Expand::ExpandCursor::Reset() {
@@ -798,6 +885,8 @@ void Expand::ExpandCursor::Reset() {
   in_edges_it_ = std::nullopt;
   out_edges_ = std::nullopt;
   out_edges_it_ = std::nullopt;
+  if (input_batch_) input_batch_->Clear();
+  input_row_ = 0;
 }
 
 bool Expand::ExpandCursor::InitEdges(Frame &frame, ExecutionContext &context) {
@@ -805,55 +894,59 @@ bool Expand::ExpandCursor::InitEdges(Frame &frame, ExecutionContext &context) {
   // those cases we skip that input pull and continue with the next.
   while (true) {
     if (!input_cursor_->Pull(frame, context)) return false;
-    TypedValue &vertex_value = frame[self_.input_symbol_];
+    if (InitEdgesFromRow(frame, context)) return true;
+  }
+}
 
-    // Null check due to possible failed optional match.
-    if (vertex_value.IsNull()) continue;
+bool Expand::ExpandCursor::InitEdgesFromRow(Frame &frame, ExecutionContext &context) {
+  TypedValue &vertex_value = frame[self_.input_symbol_];
 
-    ExpectType(self_.input_symbol_, vertex_value, TypedValue::Type::Vertex);
-    auto &vertex = vertex_value.ValueVertex();
+  // Null check due to possible failed optional match.
+  if (vertex_value.IsNull()) return false;
 
-    auto direction = self_.common_.direction;
-    if (direction == EdgeAtom::Direction::IN || direction == EdgeAtom::Direction::BOTH) {
-      if (self_.common_.existing_node) {
-        TypedValue &existing_node = frame[self_.common_.node_symbol];
-        // old_node_value may be Null when using optional matching
-        if (!existing_node.IsNull()) {
-          ExpectType(self_.common_.node_symbol, existing_node, TypedValue::Type::Vertex);
-          context.db_accessor->PrefetchInEdges(vertex);
-          in_edges_.emplace(
-              UnwrapEdgesResult(vertex.InEdges(self_.view_, self_.common_.edge_types, existing_node.ValueVertex())));
-        }
-      } else {
+  ExpectType(self_.input_symbol_, vertex_value, TypedValue::Type::Vertex);
+  auto &vertex = vertex_value.ValueVertex();
+
+  auto direction = self_.common_.direction;
+  if (direction == EdgeAtom::Direction::IN || direction == EdgeAtom::Direction::BOTH) {
+    if (self_.common_.existing_node) {
+      TypedValue &existing_node = frame[self_.common_.node_symbol];
+      // old_node_value may be Null when using optional matching
+      if (!existing_node.IsNull()) {
+        ExpectType(self_.common_.node_symbol, existing_node, TypedValue::Type::Vertex);
         context.db_accessor->PrefetchInEdges(vertex);
-        in_edges_.emplace(UnwrapEdgesResult(vertex.InEdges(self_.view_, self_.common_.edge_types)));
-      }
-      if (in_edges_) {
-        in_edges_it_.emplace(in_edges_->begin());
+        in_edges_.emplace(
+            UnwrapEdgesResult(vertex.InEdges(self_.view_, self_.common_.edge_types, existing_node.ValueVertex())));
       }
+    } else {
+      context.db_accessor->PrefetchInEdges(vertex);
+      in_edges_.emplace(UnwrapEdgesResult(vertex.InEdges(self_.view_, self_.common_.edge_types)));
+    }
+    if (in_edges_) {
+      in_edges_it_.emplace(in_edges_->begin());
     }
+  }
 
-    if (direction == EdgeAtom::Direction::OUT || direction == EdgeAtom::Direction::BOTH) {
-      if (self_.common_.existing_node) {
-        TypedValue &existing_node = frame[self_.common_.node_symbol];
-        // old_node_value may be Null when using optional matching
-        if (!existing_node.IsNull()) {
-          ExpectType(self_.common_.node_symbol, existing_node, TypedValue::Type::Vertex);
-          context.db_accessor->PrefetchOutEdges(vertex);
-          out_edges_.emplace(
-              UnwrapEdgesResult(vertex.OutEdges(self_.view_, self_.common_.edge_types, existing_node.ValueVertex())));
-        }
-      } else {
+  if (direction == EdgeAtom::Direction::OUT || direction == EdgeAtom::Direction::BOTH) {
+    if (self_.common_.existing_node) {
+      TypedValue &existing_node = frame[self_.common_.node_symbol];
+      // old_node_value may be Null when using optional matching
+      if (!existing_node.IsNull()) {
+        ExpectType(self_.common_.node_symbol, existing_node, TypedValue::Type::Vertex);
         context.db_accessor->PrefetchOutEdges(vertex);
-        out_edges_.emplace(UnwrapEdgesResult(vertex.OutEdges(self_.view_, self_.common_.edge_types)));
-      }
-      if (out_edges_) {
-        out_edges_it_.emplace(out_edges_->begin());
+        out_edges_.emplace(
+            UnwrapEdgesResult(vertex.OutEdges(self_.view_, self_.common_.edge_types, existing_node.ValueVertex())));
       }
+    } else {
+      context.db_accessor->PrefetchOutEdges(vertex);
+      out_edges_.emplace(UnwrapEdgesResult(vertex.OutEdges(self_.view_, self_.common_.edge_types)));
+    }
+    if (out_edges_) {
+      out_edges_it_.emplace(out_edges_->begin());
     }
-
-    return true;
   }
+
+  return true;
 }
 
 ExpandVariable::ExpandVariable(const std::shared_ptr<LogicalOperator> &input, Symbol input_symbol, Symbol node_symbol,
@@ -1154,6 +1247,14 @@ class ExpandVariableCursor : public Cursor {
   }
 };
 
+// Maps each vertex visited by a breadth-first expansion to the edge it was
+// reached through, or to nullopt for the vertex the expansion started from.
+// The table is flat and keyed by the vertex Gid, so a visited vertex costs a
+// single slot instead of a node holding a whole `VertexAccessor`.
+using VisitedEdgeMap =
+    absl::flat_hash_map<storage::Gid, std::optional<EdgeAccessor>, std::hash<storage::Gid>, std::equal_to<>,
+                        utils::Allocator<std::pair<const storage::Gid, std::optional<EdgeAccessor>>>>;
+
 class STShortestPathCursor : public query::plan::Cursor {
  public:
   STShortestPathCursor(const ExpandVariable &self, utils::MemoryResource *mem)
@@ -1188,7 +1289,7 @@ class STShortestPathCursor : public query::plan::Cursor {
 
       if (upper_bound < 1 || lower_bound > upper_bound) continue;
 
-      if (FindPath(*context.db_accessor, source, sink, lower_bound, upper_bound, &frame, &evaluator, context)) {
+      if (FindPath(source, sink, lower_bound, upper_bound, &frame, &evaluator, context)) {
         return true;
       }
     }
@@ -1203,14 +1304,12 @@ class STShortestPathCursor : public query::plan::Cursor {
   const ExpandVariable &self_;
   UniqueCursorPtr input_cursor_;
 
-  using VertexEdgeMapT = utils::pmr::unordered_map<VertexAccessor, std::optional<EdgeAccessor>>;
-
-  void ReconstructPath(const VertexAccessor &midpoint, const VertexEdgeMapT &in_edge, const VertexEdgeMapT &out_edge,
+  void ReconstructPath(const VertexAccessor &midpoint, const VisitedEdgeMap &in_edge, const VisitedEdgeMap &out_edge,
                        Frame *frame, utils::MemoryResource *pull_memory) {
     utils::pmr::vector<TypedValue> result(pull_memory);
     auto last_vertex = midpoint;
     while (true) {
-      const auto &last_edge = in_edge.at(last_vertex);
+      const auto &last_edge = in_edge.at(last_vertex.Gid());
       if (!last_edge) break;
       last_vertex = last_edge->From() == last_vertex ? last_edge->To() : last_edge->From();
       result.emplace_back(*last_edge);
@@ -1218,7 +1317,7 @@ class STShortestPathCursor : public query::plan::Cursor {
     std::reverse(result.begin(), result.end());
     last_vertex = midpoint;
     while (true) {
-      const auto &last_edge = out_edge.at(last_vertex);
+      const auto &last_edge = out_edge.at(last_vertex.Gid());
       if (!last_edge) break;
       last_vertex = last_edge->From() == last_vertex ? last_edge->To() : last_edge->From();
       result.emplace_back(*last_edge);
@@ -1240,16 +1339,69 @@ class STShortestPathCursor : public query::plan::Cursor {
     throw QueryRuntimeException("Expansion condition must evaluate to boolean or null");
   }
 
-  bool FindPath(const DbAccessor &dba, const VertexAccessor &source, const VertexAccessor &sink, int64_t lower_bound,
-                int64_t upper_bound, Frame *frame, ExpressionEvaluator *evaluator, const ExecutionContext &context) {
-    using utils::Contains;
+  // Expands every vertex of `frontier` by one level, either from the source
+  // or from the sink side, and puts the newly reached vertices into `next`.
+  // Returns the vertex in which the expansion met the one from the other
+  // side, if it did.
+  std::optional<VertexAccessor> ExpandFrontier(bool from_source, const utils::pmr::vector<VertexAccessor> &frontier,
+                                               utils::pmr::vector<VertexAccessor> *next, VisitedEdgeMap *visited,
+                                               const VisitedEdgeMap &other_visited, Frame *frame,
+                                               ExpressionEvaluator *evaluator, const ExecutionContext &context) {
+    // When expanding from the sink everything is reversed, so we have to be
+    // careful which edges we follow and which edge endpoint we pass to
+    // `ShouldExpand`.
+    const auto follow_out_edges = self_.common_.direction != (from_source ? EdgeAtom::Direction::IN
+                                                                          : EdgeAtom::Direction::OUT);
+    const auto follow_in_edges = self_.common_.direction != (from_source ? EdgeAtom::Direction::OUT
+                                                                         : EdgeAtom::Direction::IN);
+    const auto expand = [&](const VertexAccessor &vertex, const EdgeAccessor &edge, const VertexAccessor &neighbor) {
+#ifdef MG_ENTERPRISE
+      if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
+          !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
+            context.auth_checker->Has(neighbor, storage::View::OLD,
+                                      memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
+        return false;
+      }
+#endif
+      if (!ShouldExpand(from_source ? neighbor : vertex, edge, frame, evaluator)) return false;
+      if (!visited->emplace(neighbor.Gid(), edge).second) return false;
+      if (other_visited.contains(neighbor.Gid())) return true;
+      next->push_back(neighbor);
+      return false;
+    };
+
+    for (const auto &vertex : frontier) {
+      if (follow_out_edges) {
+        context.db_accessor->PrefetchOutEdges(vertex);
+        auto out_edges = UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types));
+        for (const auto &edge : out_edges) {
+          if (expand(vertex, edge, edge.To())) return edge.To();
+        }
+      }
+      if (follow_in_edges) {
+        context.db_accessor->PrefetchInEdges(vertex);
+        auto in_edges = UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types));
+        for (const auto &edge : in_edges) {
+          if (expand(vertex, edge, edge.From())) return edge.From();
+        }
+      }
+    }
+    return std::nullopt;
+  }
 
+  bool FindPath(const VertexAccessor &source, const VertexAccessor &sink, int64_t lower_bound, int64_t upper_bound,
+                Frame *frame, ExpressionEvaluator *evaluator, const ExecutionContext &context) {
     if (source == sink) return false;
 
     // We expand from both directions, both from the source and the sink.
     // Expansions meet at the middle of the path if it exists. This should
     // perform better for real-world like graphs where the expansion front
     // grows exponentially, effectively reducing the exponent by half.
+    //
+    // Each step expands the side with the smaller frontier. Every step adds
+    // one to the length of the paths that can be found, so the first meeting
+    // still gives the shortest path no matter which side was expanded, but
+    // we avoid expanding a hub-heavy frontier when the other one is small.
 
     auto *pull_memory = evaluator->GetMemoryResource();
     // Holds vertices at the current level of expansion from the source
@@ -1264,148 +1416,35 @@ class STShortestPathCursor : public query::plan::Cursor {
 
     // Maps each vertex we visited expanding from the source (sink) to the
     // edge used. Necessary for path reconstruction.
-    VertexEdgeMapT in_edge(pull_memory);
-    VertexEdgeMapT out_edge(pull_memory);
+    VisitedEdgeMap in_edge(pull_memory);
+    VisitedEdgeMap out_edge(pull_memory);
 
     size_t current_length = 0;
 
     source_frontier.emplace_back(source);
-    in_edge[source] = std::nullopt;
+    in_edge.emplace(source.Gid(), std::nullopt);
     sink_frontier.emplace_back(sink);
-    out_edge[sink] = std::nullopt;
+    out_edge.emplace(sink.Gid(), std::nullopt);
 
     while (true) {
       AbortCheck(context);
-      // Top-down step (expansion from the source).
       ++current_length;
       if (current_length > upper_bound) return false;
 
-      for (const auto &vertex : source_frontier) {
-        if (self_.common_.direction != EdgeAtom::Direction::IN) {
-          context.db_accessor->PrefetchOutEdges(vertex);
-          auto out_edges = UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types));
-          for (const auto &edge : out_edges) {
-#ifdef MG_ENTERPRISE
-            if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
-                !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
-                  context.auth_checker->Has(edge.To(), storage::View::OLD,
-                                            memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
-              continue;
-            }
-#endif
-
-            if (ShouldExpand(edge.To(), edge, frame, evaluator) && !Contains(in_edge, edge.To())) {
-              in_edge.emplace(edge.To(), edge);
-              if (Contains(out_edge, edge.To())) {
-                if (current_length >= lower_bound) {
-                  ReconstructPath(edge.To(), in_edge, out_edge, frame, pull_memory);
-                  return true;
-                } else {
-                  return false;
-                }
-              }
-              source_next.push_back(edge.To());
-            }
-          }
-        }
-        if (self_.common_.direction != EdgeAtom::Direction::OUT) {
-          dba.PrefetchInEdges(vertex);
-          auto in_edges = UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types));
-          for (const auto &edge : in_edges) {
-#ifdef MG_ENTERPRISE
-            if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
-                !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
-                  context.auth_checker->Has(edge.From(), storage::View::OLD,
-                                            memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
-              continue;
-            }
-#endif
-
-            if (ShouldExpand(edge.From(), edge, frame, evaluator) && !Contains(in_edge, edge.From())) {
-              in_edge.emplace(edge.From(), edge);
-              if (Contains(out_edge, edge.From())) {
-                if (current_length >= lower_bound) {
-                  ReconstructPath(edge.From(), in_edge, out_edge, frame, pull_memory);
-                  return true;
-                } else {
-                  return false;
-                }
-              }
-              source_next.push_back(edge.From());
-            }
-          }
-        }
-      }
-
-      if (source_next.empty()) return false;
-      source_frontier.clear();
-      std::swap(source_frontier, source_next);
-
-      // Bottom-up step (expansion from the sink).
-      ++current_length;
-      if (current_length > upper_bound) return false;
-
-      // When expanding from the sink we have to be careful which edge
-      // endpoint we pass to `should_expand`, because everything is
-      // reversed.
-      for (const auto &vertex : sink_frontier) {
-        if (self_.common_.direction != EdgeAtom::Direction::OUT) {
-          context.db_accessor->PrefetchOutEdges(vertex);
-          auto out_edges = UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types));
-          for (const auto &edge : out_edges) {
-#ifdef MG_ENTERPRISE
-            if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
-                !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
-                  context.auth_checker->Has(edge.To(), storage::View::OLD,
-                                            memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
-              continue;
-            }
-#endif
-            if (ShouldExpand(vertex, edge, frame, evaluator) && !Contains(out_edge, edge.To())) {
-              out_edge.emplace(edge.To(), edge);
-              if (Contains(in_edge, edge.To())) {
-                if (current_length >= lower_bound) {
-                  ReconstructPath(edge.To(), in_edge, out_edge, frame, pull_memory);
-                  return true;
-                } else {
-                  return false;
-                }
-              }
-              sink_next.push_back(edge.To());
-            }
-          }
-        }
-        if (self_.common_.direction != EdgeAtom::Direction::IN) {
-          dba.PrefetchInEdges(vertex);
-          auto in_edges = UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types));
-          for (const auto &edge : in_edges) {
-#ifdef MG_ENTERPRISE
-            if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
-                !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
-                  context.auth_checker->Has(edge.From(), storage::View::OLD,
-                                            memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
-              continue;
-            }
-#endif
-            if (ShouldExpand(vertex, edge, frame, evaluator) && !Contains(out_edge, edge.From())) {
-              out_edge.emplace(edge.From(), edge);
-              if (Contains(in_edge, edge.From())) {
-                if (current_length >= lower_bound) {
-                  ReconstructPath(edge.From(), in_edge, out_edge, frame, pull_memory);
-                  return true;
-                } else {
-                  return false;
-                }
-              }
-              sink_next.push_back(edge.From());
-            }
-          }
-        }
+      const bool from_source = source_frontier.size() <= sink_frontier.size();
+      auto &frontier = from_source ? source_frontier : sink_frontier;
+      auto &next = from_source ? source_next : sink_next;
+      auto midpoint = ExpandFrontier(from_source, frontier, &next, from_source ? &in_edge : &out_edge,
+                                     from_source ? out_edge : in_edge, frame, evaluator, context);
+      if (midpoint) {
+        if (current_length < lower_bound) return false;
+        ReconstructPath(*midpoint, in_edge, out_edge, frame, pull_memory);
+        return true;
       }
 
-      if (sink_next.empty()) return false;
-      sink_frontier.clear();
-      std::swap(sink_frontier, sink_next);
+      if (next.empty()) return false;
+      frontier.clear();
+      std::swap(frontier, next);
     }
   }
 };
@@ -1435,7 +1474,7 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
     // "where" condition. if so, places them in the to_visit_ structure.
     auto expand_pair = [this, &evaluator, &frame, &context](EdgeAccessor edge, VertexAccessor vertex) {
       // if we already processed the given vertex it doesn't get expanded
-      if (processed_.find(vertex) != processed_.end()) return;
+      if (processed_.contains(vertex.Gid())) return;
 #ifdef MG_ENTERPRISE
       if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
           !(context.auth_checker->Has(vertex, storage::View::OLD,
@@ -1460,7 +1499,7 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
         }
       }
       to_visit_next_.emplace_back(edge, vertex);
-      processed_.emplace(vertex, edge);
+      processed_.emplace(vertex.Gid(), edge);
     };
 
     // populates the to_visit_next_ structure with expansions
@@ -1507,7 +1546,7 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
         if (upper_bound_ < 1 || lower_bound_ > upper_bound_) continue;
 
         const auto &vertex = vertex_value.ValueVertex();
-        processed_.emplace(vertex, std::nullopt);
+        processed_.emplace(vertex.Gid(), std::nullopt);
 
         expand_from_vertex(vertex);
 
@@ -1528,7 +1567,7 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
         const EdgeAccessor &last_edge = edge_list.back().ValueEdge();
         last_vertex = last_edge.From() == last_vertex ? last_edge.To() : last_edge.From();
         // origin_vertex must be in processed
-        const auto &previous_edge = processed_.find(last_vertex)->second;
+        const auto &previous_edge = processed_.find(last_vertex.Gid())->second;
         if (!previous_edge) break;
 
         edge_list.emplace_back(previous_edge.value());
@@ -1570,7 +1609,7 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
   // maps vertices to the edge they got expanded from. it is an optional
   // edge because the root does not get expanded from anything.
   // contains visited vertices as well as those scheduled to be visited.
-  utils::pmr::unordered_map<VertexAccessor, std::optional<EdgeAccessor>> processed_;
+  VisitedEdgeMap processed_;
   // edge/vertex pairs we have yet to visit, for current and next depth
   utils::pmr::vector<std::pair<EdgeAccessor, VertexAccessor>> to_visit_current_;
   utils::pmr::vector<std::pair<EdgeAccessor, VertexAccessor>> to_visit_next_;
@@ -2349,6 +2388,135 @@ static std::vector<UniqueCursorPtr> MakeCursorVector(const std::vector<std::shar
   return cursors;
 }
 
+namespace {
+
+// Comparison of a vertex property with a literal or a parameter, such as
+// `n.prop < 42` or `$value = n.prop`.
+struct PropertyComparison {
+  const BinaryOperator *op;
+  const char *cypher_op;
+  PropertyLookup *property_lookup;
+  Expression *constant;
+  bool is_property_first;
+};
+
+std::optional<PropertyComparison> GetPropertyComparison(Expression *expression) {
+  static const std::vector<std::pair<const utils::TypeInfo *, const char *>> kComparisons{
+      {&EqualOperator::kType, "="},        {&NotEqualOperator::kType, "<>"}, {&LessOperator::kType, "<"},
+      {&LessEqualOperator::kType, "<="}, {&GreaterOperator::kType, ">"},   {&GreaterEqualOperator::kType, ">="}};
+  const auto *op = utils::Downcast<BinaryOperator>(expression);
+  if (!op) return std::nullopt;
+  auto found = std::find_if(kComparisons.begin(), kComparisons.end(),
+                            [op](const auto &comparison) { return *comparison.first == op->GetTypeInfo(); });
+  if (found == kComparisons.end()) return std::nullopt;
+
+  auto as_property_lookup = [](Expression *operand) -> PropertyLookup * {
+    auto *property_lookup = utils::Downcast<PropertyLookup>(operand);
+    if (!property_lookup || !utils::Downcast<Identifier>(property_lookup->expression_)) return nullptr;
+    return property_lookup;
+  };
+  auto is_constant = [](Expression *operand) {
+    return utils::Downcast<PrimitiveLiteral>(operand) || utils::Downcast<ParameterLookup>(operand);
+  };
+  if (auto *property_lookup = as_property_lookup(op->expression1_); property_lookup && is_constant(op->expression2_)) {
+    return PropertyComparison{op, found->second, property_lookup, op->expression2_, true};
+  }
+  if (auto *property_lookup = as_property_lookup(op->expression2_); property_lookup && is_constant(op->expression1_)) {
+    return PropertyComparison{op, found->second, property_lookup, op->expression1_, false};
+  }
+  return std::nullopt;
+}
+
+TypedValue Compare(const PropertyComparison &comparison, const TypedValue &value1, const TypedValue &value2) {
+  const auto &type = comparison.op->GetTypeInfo();
+  try {
+    if (type == EqualOperator::kType) return value1 == value2;
+    if (type == NotEqualOperator::kType) return value1 != value2;
+    if (type == LessOperator::kType) return value1 < value2;
+    if (type == LessEqualOperator::kType) return value1 <= value2;
+    if (type == GreaterOperator::kType) return value1 > value2;
+    return value1 >= value2;
+  } catch (const TypedValueException &) {
+    throw QueryRuntimeException("Invalid types: {} and {} for '{}'.", value1.type(), value2.type(),
+                                comparison.cypher_op);
+  }
+}
+
+void CollectConjuncts(Expression *expression, std::vector<Expression *> *conjuncts) {
+  if (auto *and_op = utils::Downcast<AndOperator>(expression)) {
+    CollectConjuncts(and_op->expression1_, conjuncts);
+    CollectConjuncts(and_op->expression2_, conjuncts);
+    return;
+  }
+  conjuncts->push_back(expression);
+}
+
+/**
+ * Evaluates the filter on all rows of the batch and keeps only the rows for
+ * which it holds.
+ *
+ * The conjuncts of the filter are evaluated one after another over the rows
+ * which weren't filtered out yet. As with AND, a conjunct isn't evaluated on
+ * rows for which a previous one is false. Comparisons of a vertex property
+ * with a literal or a parameter evaluate the constant once per batch and read
+ * the property straight from the vertex.
+ */
+void FilterBatch(Expression *filter, FrameBatch *batch, ExecutionContext &context) {
+  std::vector<Expression *> conjuncts;
+  CollectConjuncts(filter, &conjuncts);
+
+  // A row with a Null conjunct is filtered out, but the following conjuncts
+  // are still evaluated on it, the same as with AND.
+  enum class RowState : uint8_t { SELECTED, NULL_VALUE, FILTERED_OUT };
+  std::vector<RowState> states(batch->size(), RowState::SELECTED);
+  for (auto *conjunct : conjuncts) {
+    const auto comparison = GetPropertyComparison(conjunct);
+    std::optional<TypedValue> constant;
+    std::optional<Symbol> symbol;
+    if (comparison) {
+      symbol.emplace(context.symbol_table.at(*utils::Downcast<Identifier>(comparison->property_lookup->expression_)));
+    }
+
+    for (size_t row = 0; row < batch->size(); ++row) {
+      if (states[row] == RowState::FILTERED_OUT) continue;
+      auto &frame = (*batch)[row];
+      // Like all filters, newly set values should not affect filtering of old
+      // nodes and edges.
+      ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                    storage::View::OLD, context.frame_change_collector);
+      auto evaluate = [&]() -> TypedValue {
+        if (!comparison) return conjunct->Accept(evaluator);
+        if (!constant) constant.emplace(comparison->constant->Accept(evaluator));
+        auto property = [&]() -> TypedValue {
+          const auto &value = frame[*symbol];
+          if (value.IsVertex()) {
+            const auto property_id = context.evaluation_context.properties[comparison->property_lookup->property_.ix];
+            auto maybe_property = value.ValueVertex().GetProperty(storage::View::OLD, property_id);
+            if (maybe_property.HasValue()) return TypedValue(*maybe_property, context.evaluation_context.memory);
+          }
+          // Other values and errors are handled by the expression evaluator.
+          return comparison->property_lookup->Accept(evaluator);
+        }();
+        return comparison->is_property_first ? Compare(*comparison, property, *constant)
+                                             : Compare(*comparison, *constant, property);
+      };
+
+      const auto result = evaluate();
+      if (result.IsNull()) {
+        states[row] = RowState::NULL_VALUE;
+        continue;
+      }
+      if (result.type() != TypedValue::Type::Bool) {
+        throw QueryRuntimeException("Filter expression must evaluate to bool or null, got {}.", result.type());
+      }
+      if (!result.ValueBool()) states[row] = RowState::FILTERED_OUT;
+    }
+  }
+  batch->KeepIf([&states](size_t row) { return states[row] == RowState::SELECTED; });
+}
+
+}  // namespace
+
 Filter::FilterCursor::FilterCursor(const Filter &self, utils::MemoryResource *mem)
     : self_(self),
       input_cursor_(self_.input_->MakeCursor(mem)),
@@ -2370,6 +2538,18 @@ bool Filter::FilterCursor::Pull(Frame &frame, ExecutionContext &context) {
   return false;
 }
 
+bool Filter::FilterCursor::PullBatch(Frame &frame, FrameBatch &batch, ExecutionContext &context) {
+  // Pattern filters are evaluated on the frame of a single row.
+  if (!pattern_filter_cursors_.empty()) return Cursor::PullBatch(frame, batch, context);
+  SCOPED_PROFILE_OP("Filter");
+
+  while (input_cursor_->PullBatch(frame, batch, context)) {
+    FilterBatch(self_.expression_, &batch, context);
+    if (!batch.empty()) return true;
+  }
+  return false;
+}
+
 void Filter::FilterCursor::Shutdown() { input_cursor_->Shutdown(); }
 
 void Filter::FilterCursor::Reset() { input_cursor_->Reset(); }
@@ -2449,6 +2629,24 @@ bool Produce::ProduceCursor::Pull(Frame &frame, ExecutionContext &context) {
   return false;
 }
 
+bool Produce::ProduceCursor::PullBatch(Frame &frame, FrameBatch &batch, ExecutionContext &context) {
+  SCOPED_PROFILE_OP("Produce");
+
+  if (!input_cursor_->PullBatch(frame, batch, context)) return false;
+  for (size_t row = 0; row < batch.size(); ++row) {
+    // Produce should always yield the latest results.
+    ExpressionEvaluator evaluator(&batch[row], context.symbol_table, context.evaluation_context, context.db_accessor,
+                                  storage::View::NEW, context.frame_change_collector);
+    for (auto *named_expr : self_.named_expressions_) {
+      if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(named_expr->name_)) {
+        context.frame_change_collector->ResetTrackingValue(named_expr->name_);
+      }
+      named_expr->Accept(evaluator);
+    }
+  }
+  return true;
+}
+
 void Produce::ProduceCursor::Shutdown() { input_cursor_->Shutdown(); }
 
 void Produce::ProduceCursor::Reset() { input_cursor_->Reset(); }
@@ -3323,12 +3521,358 @@ TypedValue DefaultAggregationOpValue(const Aggregate::Element &element, utils::M
       return TypedValue(query::Graph(memory));
   }
 }
+
+/**
+ * Aggregation state for the common case of a single group-by key whose
+ * aggregations are COUNT, SUM and AVG without DISTINCT.
+ *
+ * Groups are found through an open-addressing table keyed on the raw 64-bit
+ * representation of the key (the integer itself, the vertex gid or the hash of
+ * the string), so no TypedValue vectors are built, hashed or compared per
+ * row. Aggregation state is kept in one column per aggregation instead of a
+ * TypedValue per group and aggregation. Keys of other types can't be handled,
+ * in which case the caller moves the groups into the generic aggregation.
+ */
+class FlatAggregation {
+ public:
+  FlatAggregation(const Aggregate &self, utils::MemoryResource *mem)
+      : self_(self), slots_(mem), keys_(mem), remember_(mem), columns_(mem) {
+    columns_.reserve(self_.aggregations_.size());
+    for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) columns_.emplace_back(mem);
+  }
+
+  static bool IsApplicable(const Aggregate &self) {
+    if (self.group_by_.size() != 1) return false;
+    return std::all_of(self.aggregations_.begin(), self.aggregations_.end(), [](const auto &elem) {
+      if (elem.distinct) return false;
+      return elem.op == Aggregation::Op::COUNT || elem.op == Aggregation::Op::SUM || elem.op == Aggregation::Op::AVG;
+    });
+  }
+
+  /// Aggregates the current row into the group of the given key. Returns false
+  /// without modifying anything if the key type isn't supported.
+  bool Process(const TypedValue &key, const Frame &frame, ExpressionEvaluator *evaluator) {
+    const auto group = FindOrInsert(key, frame);
+    if (group == kNoGroup) return false;
+
+    for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
+      const auto &elem = self_.aggregations_[pos];
+      auto &column = columns_[pos];
+      // COUNT(*) is the only case where input expression is optional.
+      if (!elem.value) {
+        ++column.counts[group];
+        continue;
+      }
+      TypedValue input_value = elem.value->Accept(*evaluator);
+      // Aggregations skip Null input values.
+      if (input_value.IsNull()) continue;
+      ++column.counts[group];
+      if (elem.op == Aggregation::Op::COUNT) continue;
+      // SUM and AVG follow TypedValue addition: the sum stays an integer
+      // until the first double is added.
+      switch (input_value.type()) {
+        case TypedValue::Type::Int:
+          if (column.is_double[group]) {
+            column.double_sums[group] += static_cast<double>(input_value.ValueInt());
+          } else {
+            column.int_sums[group] += input_value.ValueInt();
+          }
+          break;
+        case TypedValue::Type::Double:
+          if (!column.is_double[group]) {
+            column.is_double[group] = 1;
+            column.double_sums[group] = static_cast<double>(column.int_sums[group]);
+          }
+          column.double_sums[group] += input_value.ValueDouble();
+          break;
+        default:
+          throw QueryRuntimeException("Only numeric values allowed in SUM and AVG aggregations.");
+      }
+    }
+    return true;
+  }
+
+  size_t size() const { return keys_.size(); }
+
+  const TypedValue &Key(size_t group) const { return keys_[group]; }
+
+  int64_t Count(size_t group, size_t pos) const { return columns_[pos].counts[group]; }
+
+  /// Returns the aggregated value. AVG is divided by the count only if
+  /// `finalize_avg` is set, otherwise its running sum is returned.
+  TypedValue Value(size_t group, size_t pos, bool finalize_avg, utils::MemoryResource *mem) const {
+    const auto &elem = self_.aggregations_[pos];
+    const auto &column = columns_[pos];
+    const auto count = column.counts[group];
+    if (elem.op == Aggregation::Op::COUNT) return TypedValue(count, mem);
+    if (count == 0) return DefaultAggregationOpValue(elem, mem);
+    if (elem.op == Aggregation::Op::AVG && finalize_avg) {
+      const auto sum =
+          column.is_double[group] ? column.double_sums[group] : static_cast<double>(column.int_sums[group]);
+      return TypedValue(sum / static_cast<double>(count), mem);
+    }
+    if (column.is_double[group]) return TypedValue(column.double_sums[group], mem);
+    return TypedValue(column.int_sums[group], mem);
+  }
+
+  const TypedValue &Remember(size_t group, size_t pos) const { return remember_[group * self_.remember_.size() + pos]; }
+
+  void Clear() {
+    slots_.clear();
+    keys_.clear();
+    remember_.clear();
+    for (auto &column : columns_) {
+      column.counts.clear();
+      column.int_sums.clear();
+      column.double_sums.clear();
+      column.is_double.clear();
+    }
+  }
+
+ private:
+  static constexpr uint32_t kNoGroup = std::numeric_limits<uint32_t>::max();
+
+  enum class KeyKind : uint8_t { INT, STRING, VERTEX };
+
+  struct Slot {
+    uint64_t raw{0};
+    uint32_t group{kNoGroup};
+    KeyKind kind{KeyKind::INT};
+  };
+
+  struct Column {
+    explicit Column(utils::MemoryResource *mem) : counts(mem), int_sums(mem), double_sums(mem), is_double(mem) {}
+
+    utils::pmr::vector<int64_t> counts;
+    utils::pmr::vector<int64_t> int_sums;
+    utils::pmr::vector<double> double_sums;
+    utils::pmr::vector<uint8_t> is_double;
+  };
+
+  static uint64_t Mix(uint64_t raw, KeyKind kind) {
+    // Finalizer of MurmurHash3, spreads sequential keys over the table.
+    raw ^= static_cast<uint64_t>(kind);
+    raw ^= raw >> 33U;
+    raw *= 0xff51afd7ed558ccdULL;
+    raw ^= raw >> 33U;
+    raw *= 0xc4ceb9fe1a85ec53ULL;
+    raw ^= raw >> 33U;
+    return raw;
+  }
+
+  uint32_t FindOrInsert(const TypedValue &key, const Frame &frame) {
+    uint64_t raw = 0;
+    KeyKind kind{};
+    switch (key.type()) {
+      case TypedValue::Type::Int:
+        raw = static_cast<uint64_t>(key.ValueInt());
+        kind = KeyKind::INT;
+        break;
+      case TypedValue::Type::String:
+        raw = std::hash<std::string_view>{}(key.ValueString());
+        kind = KeyKind::STRING;
+        break;
+      case TypedValue::Type::Vertex:
+        raw = key.ValueVertex().Gid().AsUint();
+        kind = KeyKind::VERTEX;
+        break;
+      default:
+        return kNoGroup;
+    }
+
+    // Keep the load factor at or below one half.
+    if ((keys_.size() + 1) * 2 > slots_.size()) Grow();
+    const auto mask = slots_.size() - 1;
+    for (auto index = Mix(raw, kind) & mask;; index = (index + 1) & mask) {
+      auto &slot = slots_[index];
+      if (slot.group == kNoGroup) {
+        slot = Slot{raw, static_cast<uint32_t>(keys_.size()), kind};
+        AddGroup(key, frame);
+        return slot.group;
+      }
+      if (slot.raw == raw && slot.kind == kind &&
+          (kind != KeyKind::STRING || keys_[slot.group].ValueString() == key.ValueString())) {
+        return slot.group;
+      }
+    }
+  }
+
+  void AddGroup(const TypedValue &key, const Frame &frame) {
+    keys_.push_back(key);
+    for (const Symbol &remember_sym : self_.remember_) remember_.push_back(frame[remember_sym]);
+    for (size_t pos = 0; pos < columns_.size(); ++pos) {
+      auto &column = columns_[pos];
+      column.counts.push_back(0);
+      if (self_.aggregations_[pos].op == Aggregation::Op::COUNT) continue;
+      column.int_sums.push_back(0);
+      column.double_sums.push_back(0.0);
+      column.is_double.push_back(0);
+    }
+  }
+
+  void Grow() {
+    const auto capacity = std::max(slots_.size() * 2, size_t{1024});
+    if (capacity / 2 >= kNoGroup) throw QueryRuntimeException("Too many groups in aggregation.");
+    utils::pmr::vector<Slot> old_slots(capacity, slots_.get_allocator());
+    old_slots.swap(slots_);
+    const auto mask = capacity - 1;
+    for (const auto &slot : old_slots) {
+      if (slot.group == kNoGroup) continue;
+      auto index = Mix(slot.raw, slot.kind) & mask;
+      while (slots_[index].group != kNoGroup) index = (index + 1) & mask;
+      slots_[index] = slot;
+    }
+  }
+
+  const Aggregate &self_;
+  utils::pmr::vector<Slot> slots_;
+  // Group key and the remembered values of each group, in insertion order.
+  utils::pmr::vector<TypedValue> keys_;
+  utils::pmr::vector<TypedValue> remember_;
+  // One column per aggregation, indexed by group.
+  utils::pmr::vector<Column> columns_;
+};
+
+/**
+ * Input of an Aggregate which can be scanned and aggregated on multiple
+ * threads: all vertices, or all vertices with a label, followed by Filters
+ * without patterns. Only aggregations whose partial results can be merged are
+ * supported, that is COUNT, SUM, AVG, MIN and MAX without DISTINCT.
+ */
+struct ParallelScanInput {
+  static std::optional<ParallelScanInput> Make(const Aggregate &self) {
+    if (!std::all_of(self.aggregations_.begin(), self.aggregations_.end(), [](const auto &elem) {
+          if (elem.distinct) return false;
+          switch (elem.op) {
+            case Aggregation::Op::COUNT:
+            case Aggregation::Op::SUM:
+            case Aggregation::Op::AVG:
+            case Aggregation::Op::MIN:
+            case Aggregation::Op::MAX:
+              return true;
+            default:
+              return false;
+          }
+        })) {
+      return std::nullopt;
+    }
+
+    ParallelScanInput input;
+    const auto *op = self.input().get();
+    while (const auto *filter = utils::Downcast<const Filter>(op)) {
+      if (!filter->pattern_filters_.empty()) return std::nullopt;
+      input.filters.push_back(filter->expression_);
+      op = filter->input().get();
+    }
+    if (op->GetTypeInfo() != ScanAll::kType && op->GetTypeInfo() != ScanAllByLabel::kType) return std::nullopt;
+    input.scan = static_cast<const ScanAll *>(op);
+    if (input.scan->input()->GetTypeInfo() != Once::kType) return std::nullopt;
+    // Filters closer to the scan are evaluated first.
+    std::reverse(input.filters.begin(), input.filters.end());
+    return input;
+  }
+
+  const ScanAll *scan{nullptr};
+  std::vector<Expression *> filters;
+};
+
+/**
+ * Hands out the vertices of a scan in morsels to the threads executing it.
+ * Only advancing the iterator is serialized, the vertices of a morsel are
+ * processed without holding the lock.
+ */
+class MorselDispatcher {
+ public:
+  static constexpr size_t kMorselSize = 10'000;
+
+  explicit MorselDispatcher(VerticesIterable vertices) : vertices_(std::move(vertices)), it_(vertices_.begin()) {}
+
+  /// Replaces the content of `morsel` with the next vertices. Returns false
+  /// once all of the vertices have been handed out.
+  bool Next(std::vector<VertexAccessor> *morsel) {
+    morsel->clear();
+    std::lock_guard<std::mutex> guard(lock_);
+    for (; it_ != vertices_.end() && morsel->size() < kMorselSize; ++it_) morsel->push_back(*it_);
+    return !morsel->empty();
+  }
+
+ private:
+  VerticesIterable vertices_;
+  decltype(vertices_.begin()) it_;
+  std::mutex lock_;
+};
+
+/// Rebinds the vertices and edges in `value` to `transaction`. The threads of a
+/// parallel scan read the graph through their own copies of the transaction
+/// because the delta chain cache of a transaction isn't thread safe.
+void RebindToTransaction(TypedValue *value, storage::Transaction *transaction) {
+  switch (value->type()) {
+    case TypedValue::Type::Vertex:
+      value->ValueVertex().impl_.transaction_ = transaction;
+      break;
+    case TypedValue::Type::Edge:
+      value->ValueEdge().impl_.transaction_ = transaction;
+      break;
+    case TypedValue::Type::Path:
+      for (auto &vertex : value->ValuePath().vertices()) vertex.impl_.transaction_ = transaction;
+      for (auto &edge : value->ValuePath().edges()) edge.impl_.transaction_ = transaction;
+      break;
+    case TypedValue::Type::List:
+      for (auto &elem : value->ValueList()) RebindToTransaction(&elem, transaction);
+      break;
+    case TypedValue::Type::Map:
+      for (auto &[key, elem] : value->ValueMap()) RebindToTransaction(&elem, transaction);
+      break;
+    case TypedValue::Type::Graph: {
+      // The accessors are the keys of the graph's sets, so the graph is rebuilt.
+      auto &graph = value->ValueGraph();
+      Graph rebound(graph.GetMemoryResource());
+      for (auto vertex : graph.vertices()) {
+        vertex.impl_.transaction_ = transaction;
+        rebound.InsertVertex(vertex);
+      }
+      for (auto edge : graph.edges()) {
+        edge.impl_.transaction_ = transaction;
+        rebound.InsertEdge(edge);
+      }
+      graph = std::move(rebound);
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+/// Returns true if all operators of the input branch produce their rows in
+/// batches, in which case pulling the branch in batches avoids a virtual call
+/// and an evaluator per row and operator.
+bool PullsInBatches(const LogicalOperator &input) {
+  const auto *op = &input;
+  while (op->GetTypeInfo() != Once::kType) {
+    const auto &type = op->GetTypeInfo();
+    if (!utils::IsSubtype(type, ScanAll::kType) && type != Expand::kType && type != Filter::kType &&
+        type != Produce::kType) {
+      return false;
+    }
+    op = op->input().get();
+  }
+  return true;
+}
 }  // namespace
 
 class AggregateCursor : public Cursor {
  public:
   AggregateCursor(const Aggregate &self, utils::MemoryResource *mem)
-      : self_(self), input_cursor_(self_.input_->MakeCursor(mem)), aggregation_(mem) {}
+      : self_(self),
+        input_cursor_(self_.input_->MakeCursor(mem)),
+        aggregation_(mem),
+        parallel_scan_input_(ParallelScanInput::Make(self_)),
+        pull_input_in_batches_(PullsInBatches(*self_.input_)) {
+    if (FlatAggregation::IsApplicable(self_)) {
+      flat_aggregation_.emplace(self_, mem);
+      use_flat_aggregation_ = true;
+    }
+  }
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     SCOPED_PROFILE_OP("Aggregate");
@@ -3337,8 +3881,9 @@ class AggregateCursor : public Cursor {
       ProcessAll(&frame, &context);
       pulled_all_input_ = true;
       aggregation_it_ = aggregation_.begin();
+      flat_group_ = 0;
 
-      if (aggregation_.empty()) {
+      if (use_flat_aggregation_ ? flat_aggregation_->size() == 0 : aggregation_.empty()) {
         auto *pull_memory = context.evaluation_context.memory;
         // place default aggregation values on the frame
         for (const auto &elem : self_.aggregations_) {
@@ -3359,6 +3904,19 @@ class AggregateCursor : public Cursor {
       }
     }
 
+    if (use_flat_aggregation_) {
+      if (flat_group_ == flat_aggregation_->size()) return false;
+      auto *pull_memory = context.evaluation_context.memory;
+      for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
+        frame[self_.aggregations_[pos].output_sym] = flat_aggregation_->Value(flat_group_, pos, true, pull_memory);
+      }
+      for (size_t pos = 0; pos < self_.remember_.size(); ++pos) {
+        frame[self_.remember_[pos]] = flat_aggregation_->Remember(flat_group_, pos);
+      }
+      ++flat_group_;
+      return true;
+    }
+
     if (aggregation_it_ == aggregation_.end()) return false;
 
     // place aggregation values on the frame
@@ -3380,6 +3938,11 @@ class AggregateCursor : public Cursor {
     input_cursor_->Reset();
     aggregation_.clear();
     aggregation_it_ = aggregation_.begin();
+    if (flat_aggregation_) {
+      flat_aggregation_->Clear();
+      use_flat_aggregation_ = true;
+    }
+    flat_group_ = 0;
     pulled_all_input_ = false;
   }
 
@@ -3409,20 +3972,68 @@ class AggregateCursor : public Cursor {
     utils::pmr::vector<TSet> unique_values_;
   };
 
+  // map key is the vector of group-by values
+  // map value is an AggregationValue struct
+  using AggregationMap =
+      utils::pmr::unordered_map<utils::pmr::vector<TypedValue>, AggregationValue,
+                                // use FNV collection hashing specialized for a
+                                // vector of TypedValues
+                                utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue, TypedValue::Hash>,
+                                // custom equality
+                                TypedValueVectorEqual>;
+
+  // Partial aggregation of the vertices scanned by a single thread. The graph
+  // is read through a copy of the query's transaction, which sees the same
+  // versions because the query is read-only, but has its own delta chain cache.
+  struct ParallelScanWorker {
+    ParallelScanWorker(Frame *frame, const ExecutionContext &context, const storage::Transaction &query_transaction,
+                       utils::MemoryResource *query_memory)
+        : transaction(query_transaction.transaction_id.load(std::memory_order_acquire),
+                      query_transaction.start_timestamp, query_transaction.isolation_level,
+                      query_transaction.storage_mode),
+          memory(kParallelScanMemoryBlockSize, query_memory),
+          frame(context.symbol_table.max_position(), &memory),
+          evaluation_context(context.evaluation_context),
+          aggregation(&memory) {
+      transaction.command_id = query_transaction.command_id;
+      // Symbols bound outside of the scanned branch, e.g. by an outer Apply,
+      // are visible to each of the threads.
+      for (size_t pos = 0; pos < frame->elems().size(); ++pos) {
+        this->frame.elems()[pos] = frame->elems()[pos];
+        RebindToTransaction(&this->frame.elems()[pos], &transaction);
+      }
+    }
+
+    storage::Transaction transaction;
+    utils::MonotonicBufferResource memory;
+    Frame frame;
+    EvaluationContext evaluation_context;
+    AggregationMap aggregation;
+    std::exception_ptr error;
+  };
+
+  static constexpr size_t kParallelScanMemoryBlockSize = 1UL * 1024UL * 1024UL;
+  static constexpr size_t kParallelScanMaxBlocksPerChunk = 128;
+  static constexpr size_t kParallelScanMaxBlockSize = 1024;
+
   const Aggregate &self_;
   const UniqueCursorPtr input_cursor_;
   // storage for aggregated data
-  // map key is the vector of group-by values
-  // map value is an AggregationValue struct
-  utils::pmr::unordered_map<utils::pmr::vector<TypedValue>, AggregationValue,
-                            // use FNV collection hashing specialized for a
-                            // vector of TypedValues
-                            utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue, TypedValue::Hash>,
-                            // custom equality
-                            TypedValueVectorEqual>
-      aggregation_;
+  AggregationMap aggregation_;
   // iterator over the accumulated cache
   decltype(aggregation_.begin()) aggregation_it_ = aggregation_.begin();
+  // specialized aggregation, set when the operator qualifies for it; it is
+  // allocated from the cursor's memory and used until a group-by key it can't
+  // handle shows up
+  std::optional<FlatAggregation> flat_aggregation_;
+  bool use_flat_aggregation_{false};
+  // next group of `flat_aggregation_` to be pulled
+  size_t flat_group_{0};
+  // set when the input can be scanned and aggregated on multiple threads
+  std::optional<ParallelScanInput> parallel_scan_input_;
+  // set when the input is pulled in batches, which are read into `input_batch_`
+  bool pull_input_in_batches_{false};
+  std::optional<FrameBatch> input_batch_;
   // this LogicalOp pulls all from the input on it's first pull
   // this switch tracks if this has been performed
   bool pulled_all_input_{false};
@@ -3437,11 +4048,13 @@ class AggregateCursor : public Cursor {
    * aggregation results, and not on the number of inputs.
    */
   void ProcessAll(Frame *frame, ExecutionContext *context) {
-    ExpressionEvaluator evaluator(frame, context->symbol_table, context->evaluation_context, context->db_accessor,
-                                  storage::View::NEW);
-    while (input_cursor_->Pull(*frame, *context)) {
-      ProcessOne(*frame, &evaluator);
+    if (UseParallelScan(*context)) {
+      ProcessAllInParallel(frame, context);
+    } else {
+      ProcessAllSerially(frame, context);
     }
+    // AVG values of the flat aggregation are calculated when they are pulled.
+    if (use_flat_aggregation_) return;
 
     // calculate AVG aggregations (so far they have only been summed)
     for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
@@ -3457,6 +4070,217 @@ class AggregateCursor : public Cursor {
     }
   }
 
+  void ProcessAllSerially(Frame *frame, ExecutionContext *context) {
+    // Profiles count rows pulled from each operator and cached values are
+    // tracked per row, so such queries are pulled one row at a time.
+    if (pull_input_in_batches_ && !context->is_profile_query && !context->frame_change_collector) {
+      if (!input_batch_) input_batch_.emplace(frame->elems().size(), frame->GetMemoryResource());
+      while (input_cursor_->PullBatch(*frame, *input_batch_, *context)) {
+        for (size_t row = 0; row < input_batch_->size(); ++row) {
+          auto &row_frame = (*input_batch_)[row];
+          ExpressionEvaluator evaluator(&row_frame, context->symbol_table, context->evaluation_context,
+                                        context->db_accessor, storage::View::NEW);
+          ProcessRow(row_frame, &evaluator);
+        }
+      }
+      return;
+    }
+
+    ExpressionEvaluator evaluator(frame, context->symbol_table, context->evaluation_context, context->db_accessor,
+                                  storage::View::NEW);
+    while (input_cursor_->Pull(*frame, *context)) ProcessRow(*frame, &evaluator);
+  }
+
+  /**
+   * Aggregates a single input row.
+   */
+  void ProcessRow(const Frame &frame, ExpressionEvaluator *evaluator) {
+    if (use_flat_aggregation_) {
+      auto key = self_.group_by_[0]->Accept(*evaluator);
+      if (flat_aggregation_->Process(key, frame, evaluator)) return;
+      MoveFlatAggregation();
+      auto *mem = aggregation_.get_allocator().GetMemoryResource();
+      utils::pmr::vector<TypedValue> group_by(mem);
+      group_by.emplace_back(std::move(key));
+      ProcessOne(frame, evaluator, std::move(group_by));
+      return;
+    }
+    ProcessOne(frame, evaluator);
+  }
+
+  bool UseParallelScan(const ExecutionContext &context) const {
+    if (!parallel_scan_input_ || context.parallel_scan_threads < 2) return false;
+    // Profiling statistics and trigger collection are kept per thread of
+    // execution, so such queries are executed serially.
+    if (context.is_profile_query || context.trigger_context_collector) return false;
+#ifdef MG_ENTERPRISE
+    if (context.auth_checker) return false;
+#endif
+    return true;
+  }
+
+  /**
+   * Scans and aggregates the input on multiple threads. The scanned vertices
+   * are handed out in morsels and each thread evaluates the filters and the
+   * aggregations into its own partial aggregation. The partial aggregations
+   * are merged into `aggregation_` once all of the vertices are processed.
+   * The calling thread is one of the workers, the others are started only if
+   * there is more than a single morsel to process.
+   */
+  void ProcessAllInParallel(Frame *frame, ExecutionContext *context) {
+    // Groups are merged into the generic aggregation.
+    use_flat_aggregation_ = false;
+    AbortCheck(*context);
+
+    const auto &scan = *parallel_scan_input_->scan;
+    auto *dba = context->db_accessor;
+    MorselDispatcher dispatcher(scan.GetTypeInfo() == ScanAllByLabel::kType
+                                    ? dba->Vertices(scan.view_, static_cast<const ScanAllByLabel &>(scan).label_)
+                                    : dba->Vertices(scan.view_));
+    std::vector<VertexAccessor> first_morsel;
+    if (!dispatcher.Next(&first_morsel)) return;
+    const auto num_threads =
+        first_morsel.size() < MorselDispatcher::kMorselSize ? size_t{1} : context->parallel_scan_threads;
+    auto *query_transaction = first_morsel.front().impl_.transaction_;
+
+    // The workers allocate from the memory of the query so that its limit
+    // applies to them as well, but that memory isn't thread safe.
+    utils::SynchronizedPoolResource query_memory(kParallelScanMaxBlocksPerChunk, kParallelScanMaxBlockSize,
+                                                 context->evaluation_context.memory);
+    std::deque<ParallelScanWorker> workers;
+    for (size_t i = 0; i < num_threads; ++i) workers.emplace_back(frame, *context, *query_transaction, &query_memory);
+    std::atomic<bool> failed{false};
+    {
+      std::vector<std::jthread> threads;
+      threads.reserve(num_threads - 1);
+      for (size_t i = 1; i < num_threads; ++i) {
+        threads.emplace_back([&, worker = &workers[i]] {
+          utils::ThreadSetName("parallel scan");
+          RunParallelScanWorker(worker, &dispatcher, {}, *context, &failed);
+        });
+      }
+      RunParallelScanWorker(&workers[0], &dispatcher, std::move(first_morsel), *context, &failed);
+    }
+
+    for (auto &worker : workers) {
+      if (worker.error) std::rethrow_exception(worker.error);
+    }
+    for (auto &worker : workers) MergePartialAggregation(worker.aggregation, query_transaction);
+  }
+
+  /**
+   * Aggregates morsels from the dispatcher into the partial aggregation of
+   * the given worker, starting with `morsel`. Any exception is stored in the
+   * worker and stops the other workers.
+   */
+  void RunParallelScanWorker(ParallelScanWorker *worker, MorselDispatcher *dispatcher,
+                             std::vector<VertexAccessor> morsel, const ExecutionContext &context,
+                             std::atomic<bool> *failed) const {
+    try {
+      utils::MonotonicBufferResource pull_memory(kParallelScanMemoryBlockSize, worker->memory.GetUpstreamResource());
+      worker->evaluation_context.memory = &pull_memory;
+      // Filters and aggregations view the graph the same way as the Filter
+      // and Aggregate cursors do.
+      ExpressionEvaluator filter_evaluator(&worker->frame, context.symbol_table, worker->evaluation_context,
+                                           context.db_accessor, storage::View::OLD);
+      ExpressionEvaluator evaluator(&worker->frame, context.symbol_table, worker->evaluation_context,
+                                    context.db_accessor, storage::View::NEW);
+      const auto &input = *parallel_scan_input_;
+      auto *mem = &worker->memory;
+      while (!failed->load(std::memory_order_acquire) && (!morsel.empty() || dispatcher->Next(&morsel))) {
+        AbortCheck(context);
+        for (const auto &vertex : morsel) {
+          auto &scanned = worker->frame[input.scan->output_symbol_];
+          scanned = vertex;
+          scanned.ValueVertex().impl_.transaction_ = &worker->transaction;
+          if (!std::all_of(input.filters.begin(), input.filters.end(),
+                           [&](auto *filter) { return EvaluateFilter(filter_evaluator, filter); })) {
+            continue;
+          }
+          utils::pmr::vector<TypedValue> group_by(mem);
+          group_by.reserve(self_.group_by_.size());
+          for (Expression *expression : self_.group_by_) {
+            group_by.emplace_back(expression->Accept(evaluator));
+          }
+          auto &agg_value = worker->aggregation.try_emplace(std::move(group_by), mem).first->second;
+          EnsureInitialized(worker->frame, &agg_value);
+          Update(&evaluator, &agg_value);
+        }
+        morsel.clear();
+        pull_memory.Release();
+      }
+    } catch (...) {
+      worker->error = std::current_exception();
+      failed->store(true, std::memory_order_release);
+    }
+  }
+
+  /**
+   * Merges the partial aggregation of a parallel scan worker into
+   * `aggregation_`. AVG values are still sums at this point. The vertices
+   * and edges of the groups are rebound to `query_transaction`.
+   */
+  void MergePartialAggregation(const AggregationMap &partial, storage::Transaction *query_transaction) {
+    auto *mem = aggregation_.get_allocator().GetMemoryResource();
+    for (const auto &[partial_group_by, partial_value] : partial) {
+      utils::pmr::vector<TypedValue> group_by(partial_group_by.begin(), partial_group_by.end(), mem);
+      // The results outlive the transactions of the workers.
+      for (auto &value : group_by) RebindToTransaction(&value, query_transaction);
+      auto [it, inserted] = aggregation_.try_emplace(std::move(group_by), mem);
+      auto &agg_value = it->second;
+      if (inserted) {
+        for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
+          agg_value.counts_.push_back(partial_value.counts_[pos]);
+          agg_value.values_.emplace_back(partial_value.values_[pos]);
+          agg_value.unique_values_.emplace_back(AggregationValue::TSet(mem));
+        }
+        for (const auto &remember_value : partial_value.remember_) {
+          RebindToTransaction(&agg_value.remember_.emplace_back(remember_value), query_transaction);
+        }
+        continue;
+      }
+
+      for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
+        const auto partial_count = partial_value.counts_[pos];
+        if (partial_count == 0) continue;
+        const auto &partial_result = partial_value.values_[pos];
+        auto &count = agg_value.counts_[pos];
+        auto &value = agg_value.values_[pos];
+        if (count == 0) {
+          value = partial_result;
+          count = partial_count;
+          continue;
+        }
+        count += partial_count;
+        switch (self_.aggregations_[pos].op) {
+          case Aggregation::Op::COUNT:
+            value = count;
+            break;
+          case Aggregation::Op::MIN:
+            try {
+              if ((partial_result < value).ValueBool()) value = partial_result;
+            } catch (const TypedValueException &) {
+              throw QueryRuntimeException("Unable to get MIN of '{}' and '{}'.", partial_result.type(), value.type());
+            }
+            break;
+          case Aggregation::Op::MAX:
+            try {
+              if ((partial_result > value).ValueBool()) value = partial_result;
+            } catch (const TypedValueException &) {
+              throw QueryRuntimeException("Unable to get MAX of '{}' and '{}'.", partial_result.type(), value.type());
+            }
+            break;
+          case Aggregation::Op::SUM:
+          case Aggregation::Op::AVG:
+            value = value + partial_result;
+            break;
+          default:
+            LOG_FATAL("Unexpected aggregation in a parallel scan.");
+        }
+      }
+    }
+  }
+
   /**
    * Performs a single accumulation.
    */
@@ -3467,11 +4291,42 @@ class AggregateCursor : public Cursor {
     for (Expression *expression : self_.group_by_) {
       group_by.emplace_back(expression->Accept(*evaluator));
     }
+    ProcessOne(frame, evaluator, std::move(group_by));
+  }
+
+  /**
+   * Performs a single accumulation with already evaluated group-by values.
+   */
+  void ProcessOne(const Frame &frame, ExpressionEvaluator *evaluator, utils::pmr::vector<TypedValue> group_by) {
+    auto *mem = aggregation_.get_allocator().GetMemoryResource();
     auto &agg_value = aggregation_.try_emplace(std::move(group_by), mem).first->second;
     EnsureInitialized(frame, &agg_value);
     Update(evaluator, &agg_value);
   }
 
+  /**
+   * Moves the groups accumulated by the flat aggregation into `aggregation_`
+   * and switches to the generic aggregation for the rest of the input.
+   */
+  void MoveFlatAggregation() {
+    auto *mem = aggregation_.get_allocator().GetMemoryResource();
+    for (size_t group = 0; group < flat_aggregation_->size(); ++group) {
+      utils::pmr::vector<TypedValue> group_by(mem);
+      group_by.emplace_back(flat_aggregation_->Key(group));
+      auto &agg_value = aggregation_.try_emplace(std::move(group_by), mem).first->second;
+      for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
+        agg_value.counts_.push_back(flat_aggregation_->Count(group, pos));
+        agg_value.values_.emplace_back(flat_aggregation_->Value(group, pos, false, mem));
+        agg_value.unique_values_.emplace_back(AggregationValue::TSet(mem));
+      }
+      for (size_t pos = 0; pos < self_.remember_.size(); ++pos) {
+        agg_value.remember_.push_back(flat_aggregation_->Remember(group, pos));
+      }
+    }
+    flat_aggregation_->Clear();
+    use_flat_aggregation_ = false;
+  }
+
   /** Ensures the new AggregationValue has been initialized. This means
    * that the value vectors are filled with an appropriate number of Nulls,
    * counts are set to 0 and remember values are remembered.
@@ -3491,7 +4346,7 @@ class AggregateCursor : public Cursor {
 
   /** Updates the given AggregationValue with new data. Assumes that
    * the AggregationValue has been initialized */
-  void Update(ExpressionEvaluator *evaluator, AggregateCursor::AggregationValue *agg_value) {
+  void Update(ExpressionEvaluator *evaluator, AggregateCursor::AggregationValue *agg_value) const {
     DMG_ASSERT(self_.aggregations_.size() == agg_value->values_.size(),
                "Expected as much AggregationValue.values_ as there are "
                "aggregations.");
@@ -3801,6 +4656,10 @@ class OrderByCursor : public Cursor {
       ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
                                     storage::View::OLD);
       auto *mem = cache_.get_allocator().GetMemoryResource();
+      const auto top_k = EvaluateTopK(evaluator);
+      auto compare = [this](const auto &pair1, const auto &pair2) {
+        return self_.compare_(pair1.order_by, pair2.order_by);
+      };
       while (input_cursor_->Pull(frame, context)) {
         // collect the order_by elements
         utils::pmr::vector<TypedValue> order_by(mem);
@@ -3809,17 +4668,32 @@ class OrderByCursor : public Cursor {
           order_by.emplace_back(expression_ptr->Accept(evaluator));
         }
 
+        if (top_k) {
+          // cache_ is a max-heap of the best top_k rows seen so far, so a row
+          // which doesn't precede the current maximum can be dropped without
+          // copying its output values.
+          if (*top_k == 0) continue;
+          if (cache_.size() == *top_k) {
+            if (!self_.compare_(order_by, cache_.front().order_by)) continue;
+            std::pop_heap(cache_.begin(), cache_.end(), compare);
+            cache_.pop_back();
+          }
+        }
+
         // collect the output elements
         utils::pmr::vector<TypedValue> output(mem);
         output.reserve(self_.output_symbols_.size());
         for (const Symbol &output_sym : self_.output_symbols_) output.emplace_back(frame[output_sym]);
 
         cache_.push_back(Element{std::move(order_by), std::move(output)});
+        if (top_k) std::push_heap(cache_.begin(), cache_.end(), compare);
       }
 
-      std::sort(cache_.begin(), cache_.end(), [this](const auto &pair1, const auto &pair2) {
-        return self_.compare_(pair1.order_by, pair2.order_by);
-      });
+      if (top_k) {
+        std::sort_heap(cache_.begin(), cache_.end(), compare);
+      } else {
+        std::sort(cache_.begin(), cache_.end(), compare);
+      }
 
       did_pull_all_ = true;
       cache_it_ = cache_.begin();
@@ -3858,6 +4732,30 @@ class OrderByCursor : public Cursor {
     utils::pmr::vector<TypedValue> remember;
   };
 
+  // Returns the number of rows that have to be retained when the ordering is
+  // bounded by a fused SKIP/LIMIT. Invalid values fall back to a full sort and
+  // are reported by the Skip and Limit operators themselves.
+  std::optional<size_t> EvaluateTopK(ExpressionEvaluator &evaluator) const {
+    if (!self_.limit_) return std::nullopt;
+    // Skip and limit expressions don't contain identifiers so graph view
+    // parameter is not important.
+    auto evaluate_count = [&evaluator](Expression *expression) -> std::optional<int64_t> {
+      TypedValue value = expression->Accept(evaluator);
+      if (value.type() != TypedValue::Type::Int || value.ValueInt() < 0) return std::nullopt;
+      return value.ValueInt();
+    };
+    const auto limit = evaluate_count(self_.limit_);
+    if (!limit) return std::nullopt;
+    int64_t skip = 0;
+    if (self_.skip_) {
+      const auto maybe_skip = evaluate_count(self_.skip_);
+      if (!maybe_skip) return std::nullopt;
+      skip = *maybe_skip;
+    }
+    if (skip > std::numeric_limits<int64_t>::max() - *limit) return std::nullopt;
+    return static_cast<size_t>(skip + *limit);
+  }
+
   const OrderBy &self_;
   const UniqueCursorPtr input_cursor_;
   bool did_pull_all_{false};
@@ -4349,6 +5247,134 @@ UniqueCursorPtr Cartesian::MakeCursor(utils::MemoryResource *mem) const {
   return MakeUniqueCursorPtr<CartesianCursor>(mem, *this, mem);
 }
 
+std::vector<Symbol> HashJoin::ModifiedSymbols(const SymbolTable &table) const {
+  auto symbols = left_op_->ModifiedSymbols(table);
+  auto right = right_op_->ModifiedSymbols(table);
+  symbols.insert(symbols.end(), right.begin(), right.end());
+  return symbols;
+}
+
+bool HashJoin::Accept(HierarchicalLogicalOperatorVisitor &visitor) {
+  if (visitor.PreVisit(*this)) {
+    left_op_->Accept(visitor) && right_op_->Accept(visitor);
+  }
+  return visitor.PostVisit(*this);
+}
+
+WITHOUT_SINGLE_INPUT(HashJoin);
+
+namespace {
+
+class HashJoinCursor : public Cursor {
+ public:
+  HashJoinCursor(const HashJoin &self, utils::MemoryResource *mem)
+      : self_(self),
+        left_op_frames_(mem),
+        hash_table_(mem),
+        left_op_cursor_(self.left_op_->MakeCursor(mem)),
+        right_op_cursor_(self_.right_op_->MakeCursor(mem)) {
+    MG_ASSERT(left_op_cursor_ != nullptr, "HashJoinCursor: Missing left operator cursor.");
+    MG_ASSERT(right_op_cursor_ != nullptr, "HashJoinCursor: Missing right operator cursor.");
+  }
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    SCOPED_PROFILE_OP("HashJoin");
+
+    if (!hash_join_initialized_) {
+      BuildHashTable(frame, context);
+      hash_join_initialized_ = true;
+    }
+
+    // If left operator yielded no joinable rows there is nothing to match.
+    if (hash_table_.empty()) {
+      return false;
+    }
+
+    while (!right_matches_ || right_match_it_ == right_matches_->end()) {
+      // Advance right_op_cursor_ until a row matches some of the left rows.
+      if (!right_op_cursor_->Pull(frame, context)) return false;
+      AbortCheck(context);
+
+      ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                    storage::View::OLD);
+      auto right_value = self_.hash_join_condition_->expression2_->Accept(evaluator);
+      // Null never compares equal, so it can't be a part of the join.
+      if (right_value.IsNull()) continue;
+      auto found = hash_table_.find(right_value);
+      if (found == hash_table_.end()) continue;
+      right_matches_ = &found->second;
+      right_match_it_ = right_matches_->begin();
+    }
+
+    // Right symbols are still on the frame from the last right pull, so only
+    // the matched left row needs to be restored.
+    const auto &left_row = left_op_frames_[*right_match_it_];
+    for (size_t i = 0; i < self_.left_symbols_.size(); ++i) {
+      const auto &symbol = self_.left_symbols_[i];
+      frame[symbol] = left_row[i];
+      if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(symbol.name())) {
+        context.frame_change_collector->ResetTrackingValue(symbol.name());
+      }
+    }
+    ++right_match_it_;
+    return true;
+  }
+
+  void Shutdown() override {
+    left_op_cursor_->Shutdown();
+    right_op_cursor_->Shutdown();
+  }
+
+  void Reset() override {
+    left_op_cursor_->Reset();
+    right_op_cursor_->Reset();
+    left_op_frames_.clear();
+    hash_table_.clear();
+    right_matches_ = nullptr;
+    hash_join_initialized_ = false;
+  }
+
+ private:
+  void BuildHashTable(Frame &frame, ExecutionContext &context) {
+    auto *mem = left_op_frames_.get_allocator().GetMemoryResource();
+    while (left_op_cursor_->Pull(frame, context)) {
+      ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                    storage::View::OLD);
+      auto left_value = self_.hash_join_condition_->expression1_->Accept(evaluator);
+      if (left_value.IsNull()) continue;
+
+      auto &left_row = left_op_frames_.emplace_back();
+      left_row.reserve(self_.left_symbols_.size());
+      for (const auto &symbol : self_.left_symbols_) {
+        left_row.emplace_back(frame[symbol]);
+      }
+      auto it = hash_table_.try_emplace(TypedValue(left_value, mem)).first;
+      it->second.push_back(left_op_frames_.size() - 1);
+    }
+  }
+
+  const HashJoin &self_;
+  // Values of left symbols for each joinable row of the left branch.
+  utils::pmr::vector<utils::pmr::vector<TypedValue>> left_op_frames_;
+  // Maps the value of the left join expression to the indices of left rows.
+  utils::pmr::unordered_map<TypedValue, utils::pmr::vector<size_t>, TypedValue::Hash, TypedValue::BoolEqual>
+      hash_table_;
+  const UniqueCursorPtr left_op_cursor_;
+  const UniqueCursorPtr right_op_cursor_;
+  // Left rows matching the last pulled right row.
+  const utils::pmr::vector<size_t> *right_matches_{nullptr};
+  utils::pmr::vector<size_t>::const_iterator right_match_it_;
+  bool hash_join_initialized_{false};
+};
+
+}  // namespace
+
+UniqueCursorPtr HashJoin::MakeCursor(utils::MemoryResource *mem) const {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::HashJoinOperator);
+
+  return MakeUniqueCursorPtr<HashJoinCursor>(mem, *this, mem);
+}
+
 OutputTable::OutputTable(std::vector<Symbol> output_symbols, std::vector<std::vector<TypedValue>> rows)
     : output_symbols_(std::move(output_symbols)), callback_([rows](Frame *, ExecutionContext *) { return rows; }) {}
 
@@ -22,6 +22,7 @@
 #include "query/common.hpp"
 #include "query/frontend/ast/ast.hpp"
 #include "query/frontend/semantic/symbol.hpp"
+#include "query/interpret/frame.hpp"
 #include "query/typed_value.hpp"
 #include "storage/v2/id_types.hpp"
 #include "utils/bound.hpp"
@@ -61,6 +62,22 @@ class Cursor {
   /// @throws QueryRuntimeException if something went wrong with execution
   virtual bool Pull(Frame &, ExecutionContext &) = 0;
 
+  /// Run iterations of a @c LogicalOperator until the batch is full or the
+  /// results are exhausted.
+  ///
+  /// The default implementation pulls one row at a time with @c Pull and
+  /// copies it into the batch. Operators on hot paths override it to produce
+  /// and consume whole batches of rows at once. A cursor is pulled either
+  /// with @c Pull or with @c PullBatch until it is reset.
+  ///
+  /// @param Frame Working frame, which must be the same on each call. Rows
+  ///     pulled one at a time are produced in it.
+  /// @param FrameBatch Cleared and filled with the produced rows.
+  /// @param ExecutionContext Same as for @c Pull.
+  ///
+  /// @return false if no rows were produced.
+  virtual bool PullBatch(Frame &, FrameBatch &, ExecutionContext &);
+
   /// Resets the Cursor to its initial state.
   virtual void Reset() = 0;
 
@@ -129,6 +146,7 @@ class Foreach;
 class EmptyResult;
 class EvaluatePatternFilter;
 class Apply;
+class HashJoin;
 
 using LogicalOperatorCompositeVisitor =
     utils::CompositeVisitor<Once, CreateNode, CreateExpand, ScanAll, ScanAllByLabel, ScanAllByLabelPropertyRange,
@@ -136,7 +154,7 @@ using LogicalOperatorCompositeVisitor =
                             ConstructNamedPath, Filter, Produce, Delete, SetProperty, SetProperties, SetLabels,
                             RemoveProperty, RemoveLabels, EdgeUniquenessFilter, Accumulate, Aggregate, Skip, Limit,
                             OrderBy, Merge, Optional, Unwind, Distinct, Union, Cartesian, CallProcedure, LoadCsv,
-                            Foreach, EmptyResult, EvaluatePatternFilter, Apply>;
+                            Foreach, EmptyResult, EvaluatePatternFilter, Apply, HashJoin>;
 
 using LogicalOperatorLeafVisitor = utils::LeafVisitor<Once>;
 
@@ -807,6 +825,7 @@ class Expand : public memgraph::query::plan::LogicalOperator {
    public:
     ExpandCursor(const Expand &, utils::MemoryResource *);
     bool Pull(Frame &, ExecutionContext &) override;
+    bool PullBatch(Frame &, FrameBatch &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
 
@@ -826,8 +845,13 @@ class Expand : public memgraph::query::plan::LogicalOperator {
     std::optional<InEdgeIteratorT> in_edges_it_;
     std::optional<OutEdgeT> out_edges_;
     std::optional<OutEdgeIteratorT> out_edges_it_;
+    // Rows of the input when pulled in batches. The edges are those of the
+    // row before `input_row_`.
+    std::optional<FrameBatch> input_batch_;
+    size_t input_row_{0};
 
     bool InitEdges(Frame &, ExecutionContext &);
+    bool InitEdgesFromRow(Frame &, ExecutionContext &);
   };
 
   std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
@@ -1046,6 +1070,7 @@ class Filter : public memgraph::query::plan::LogicalOperator {
    public:
     FilterCursor(const Filter &, utils::MemoryResource *);
     bool Pull(Frame &, ExecutionContext &) override;
+    bool PullBatch(Frame &, FrameBatch &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
 
@@ -1100,6 +1125,7 @@ class Produce : public memgraph::query::plan::LogicalOperator {
    public:
     ProduceCursor(const Produce &, utils::MemoryResource *);
     bool Pull(Frame &, ExecutionContext &) override;
+    bool PullBatch(Frame &, FrameBatch &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
 
@@ -1788,6 +1814,12 @@ class Limit : public memgraph::query::plan::LogicalOperator {
 /// For each row an arbitrary number of Frame elements can be
 /// remembered. Only these elements (defined by their Symbols)
 /// are valid for usage after the OrderBy operator.
+///
+/// When the sorted rows are followed by Skip and Limit, the planner
+/// copies their expressions into `skip_` and `limit_`. The cursor then
+/// only retains the first SKIP + LIMIT rows in a bounded heap (top-K)
+/// instead of materializing and sorting the whole input. Skip and Limit
+/// are still planned after OrderBy and perform their usual checks.
 class OrderBy : public memgraph::query::plan::LogicalOperator {
  public:
   static const utils::TypeInfo kType;
@@ -1810,6 +1842,11 @@ class OrderBy : public memgraph::query::plan::LogicalOperator {
   TypedValueVectorCompare compare_;
   std::vector<Expression *> order_by_;
   std::vector<Symbol> output_symbols_;
+  /// Optional SKIP expression of the fused top-K ordering, ignored unless
+  /// `limit_` is set as well.
+  Expression *skip_{nullptr};
+  /// Optional LIMIT expression of the fused top-K ordering.
+  Expression *limit_{nullptr};
 
   std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
     auto object = std::make_unique<OrderBy>();
@@ -1820,6 +1857,8 @@ class OrderBy : public memgraph::query::plan::LogicalOperator {
       object->order_by_[i6] = order_by_[i6] ? order_by_[i6]->Clone(storage) : nullptr;
     }
     object->output_symbols_ = output_symbols_;
+    object->skip_ = skip_ ? skip_->Clone(storage) : nullptr;
+    object->limit_ = limit_ ? limit_->Clone(storage) : nullptr;
     return object;
   }
 };
@@ -2101,6 +2140,57 @@ class Cartesian : public memgraph::query::plan::LogicalOperator {
   }
 };
 
+/// Operator for joining 2 independent input branches on an equality condition.
+///
+/// The left branch is pulled entirely and hashed on the left hand side of the
+/// condition, after which each row of the right branch is matched against it
+/// by evaluating the right hand side. This replaces a Cartesian product
+/// followed by an equality Filter.
+class HashJoin : public memgraph::query::plan::LogicalOperator {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  HashJoin() {}
+  /** Construct the operator with left input branch and right input branch.
+   *
+   * @param hash_join_condition Equality whose first expression uses only the
+   *     left symbols and whose second expression uses only the right symbols.
+   */
+  HashJoin(const std::shared_ptr<LogicalOperator> &left_op, const std::vector<Symbol> &left_symbols,
+           const std::shared_ptr<LogicalOperator> &right_op, const std::vector<Symbol> &right_symbols,
+           EqualOperator *hash_join_condition)
+      : left_op_(left_op),
+        left_symbols_(left_symbols),
+        right_op_(right_op),
+        right_symbols_(right_symbols),
+        hash_join_condition_(hash_join_condition) {}
+
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+  std::vector<Symbol> ModifiedSymbols(const SymbolTable &) const override;
+
+  bool HasSingleInput() const override;
+  std::shared_ptr<LogicalOperator> input() const override;
+  void set_input(std::shared_ptr<LogicalOperator>) override;
+
+  std::shared_ptr<memgraph::query::plan::LogicalOperator> left_op_;
+  std::vector<Symbol> left_symbols_;
+  std::shared_ptr<memgraph::query::plan::LogicalOperator> right_op_;
+  std::vector<Symbol> right_symbols_;
+  EqualOperator *hash_join_condition_{nullptr};
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
+    auto object = std::make_unique<HashJoin>();
+    object->left_op_ = left_op_ ? left_op_->Clone(storage) : nullptr;
+    object->left_symbols_ = left_symbols_;
+    object->right_op_ = right_op_ ? right_op_->Clone(storage) : nullptr;
+    object->right_symbols_ = right_symbols_;
+    object->hash_join_condition_ = hash_join_condition_ ? hash_join_condition_->Clone(storage) : nullptr;
+    return object;
+  }
+};
+
 /// An operator that outputs a table, producing a single row on each pull
 class OutputTable : public memgraph::query::plan::LogicalOperator {
  public:
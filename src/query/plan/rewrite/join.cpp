@@ -0,0 +1,198 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/plan/rewrite/join.hpp"
+
+#include <algorithm>
+
+#include "query/plan/rewrite/index_lookup.hpp"
+
+namespace memgraph::query::plan {
+
+namespace impl {
+
+namespace {
+
+void CollectUsedSymbols(Expression *expression, const SymbolTable &symbol_table, std::unordered_set<Symbol> *used) {
+  UsedSymbolsCollector collector(symbol_table);
+  expression->Accept(collector);
+  used->insert(collector.symbols_.begin(), collector.symbols_.end());
+}
+
+void CollectAndExpressions(Expression *expression, std::vector<Expression *> *expressions) {
+  if (auto *and_op = utils::Downcast<AndOperator>(expression)) {
+    CollectAndExpressions(and_op->expression1_, expressions);
+    CollectAndExpressions(and_op->expression2_, expressions);
+    return;
+  }
+  expressions->push_back(expression);
+}
+
+bool AreAllContained(const std::unordered_set<Symbol> &symbols, const std::unordered_set<Symbol> &container) {
+  return std::all_of(symbols.begin(), symbols.end(),
+                     [&container](const auto &symbol) { return utils::Contains(container, symbol); });
+}
+
+// Returns an equality from the given expressions which can be evaluated on
+// the left and on the right branch separately. The returned equality is
+// normalized so that its first expression belongs to the left branch.
+EqualOperator *FindJoinCondition(const std::vector<Expression *> &expressions,
+                                 const std::unordered_set<Symbol> &left_symbols,
+                                 const std::unordered_set<Symbol> &right_symbols, const SymbolTable &symbol_table) {
+  for (auto *expression : expressions) {
+    auto *equal = utils::Downcast<EqualOperator>(expression);
+    if (!equal) continue;
+    std::unordered_set<Symbol> first_symbols;
+    CollectUsedSymbols(equal->expression1_, symbol_table, &first_symbols);
+    std::unordered_set<Symbol> second_symbols;
+    CollectUsedSymbols(equal->expression2_, symbol_table, &second_symbols);
+    // Equalities on constants are left to the Filter.
+    if (first_symbols.empty() || second_symbols.empty()) continue;
+    if (AreAllContained(first_symbols, left_symbols) && AreAllContained(second_symbols, right_symbols)) {
+      return equal;
+    }
+    if (AreAllContained(first_symbols, right_symbols) && AreAllContained(second_symbols, left_symbols)) {
+      std::swap(equal->expression1_, equal->expression2_);
+      return equal;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+std::optional<JoinBranchSymbols> GetJoinBranchSymbols(const LogicalOperator &op, const SymbolTable &symbol_table) {
+  JoinBranchSymbols symbols;
+  if (const auto *scan = utils::Downcast<const ScanAll>(&op)) {
+    symbols.is_scan = true;
+    symbols.bound.push_back(scan->output_symbol_);
+    if (const auto *value_scan = utils::Downcast<const ScanAllByLabelPropertyValue>(&op)) {
+      CollectUsedSymbols(value_scan->expression_, symbol_table, &symbols.used);
+    } else if (const auto *range_scan = utils::Downcast<const ScanAllByLabelPropertyRange>(&op)) {
+      if (range_scan->lower_bound_) {
+        CollectUsedSymbols(range_scan->lower_bound_->value(), symbol_table, &symbols.used);
+      }
+      if (range_scan->upper_bound_) {
+        CollectUsedSymbols(range_scan->upper_bound_->value(), symbol_table, &symbols.used);
+      }
+    } else if (const auto *id_scan = utils::Downcast<const ScanAllById>(&op)) {
+      CollectUsedSymbols(id_scan->expression_, symbol_table, &symbols.used);
+    }
+    return symbols;
+  }
+  if (const auto *expand = utils::Downcast<const Expand>(&op)) {
+    symbols.used.insert(expand->input_symbol_);
+    if (expand->common_.existing_node) {
+      symbols.used.insert(expand->common_.node_symbol);
+    } else {
+      symbols.bound.push_back(expand->common_.node_symbol);
+    }
+    symbols.bound.push_back(expand->common_.edge_symbol);
+    return symbols;
+  }
+  if (const auto *filter = utils::Downcast<const Filter>(&op)) {
+    if (!filter->pattern_filters_.empty()) return std::nullopt;
+    CollectUsedSymbols(filter->expression_, symbol_table, &symbols.used);
+    return symbols;
+  }
+  if (const auto *uniqueness_filter = utils::Downcast<const EdgeUniquenessFilter>(&op)) {
+    symbols.used.insert(uniqueness_filter->expand_symbol_);
+    symbols.used.insert(uniqueness_filter->previous_symbols_.begin(), uniqueness_filter->previous_symbols_.end());
+    return symbols;
+  }
+  if (const auto *named_path = utils::Downcast<const ConstructNamedPath>(&op)) {
+    symbols.used.insert(named_path->path_elements_.begin(), named_path->path_elements_.end());
+    symbols.bound.push_back(named_path->path_symbol_);
+    return symbols;
+  }
+  return std::nullopt;
+}
+
+bool IsPatternBranch(const LogicalOperator &op, const SymbolTable &symbol_table) {
+  const auto *current = &op;
+  while (current->GetTypeInfo() != Once::kType) {
+    // Joins are only generated from pattern matching, so they are a part of
+    // the pattern as well.
+    if (current->GetTypeInfo() == HashJoin::kType) return true;
+    if (!GetJoinBranchSymbols(*current, symbol_table)) return false;
+    current = current->input().get();
+  }
+  return true;
+}
+
+void JoinRewriter::GenHashJoin(Filter &filter) {
+  if (!filter.pattern_filters_.empty()) return;
+
+  // Collect the operators under the Filter which could end up in the right
+  // branch, starting from the one closest to the Filter.
+  std::vector<std::shared_ptr<LogicalOperator>> chain;
+  std::vector<JoinBranchSymbols> chain_symbols;
+  for (auto op = filter.input(); op; op = op->input()) {
+    auto symbols = GetJoinBranchSymbols(*op, *symbol_table_);
+    if (!symbols) break;
+    chain.push_back(op);
+    chain_symbols.emplace_back(std::move(*symbols));
+  }
+
+  std::vector<Expression *> expressions;
+  CollectAndExpressions(filter.expression_, &expressions);
+
+  std::unordered_set<Symbol> right_used;
+  std::unordered_set<Symbol> right_bound;
+  for (size_t i = 0; i < chain.size(); ++i) {
+    right_used.insert(chain_symbols[i].used.begin(), chain_symbols[i].used.end());
+    right_bound.insert(chain_symbols[i].bound.begin(), chain_symbols[i].bound.end());
+    // The right branch is pulled from its own Once, so it has to start with a
+    // scan and may only use the symbols it binds by itself.
+    if (!chain_symbols[i].is_scan || !AreAllContained(right_used, right_bound)) continue;
+
+    auto left_op = chain[i]->input();
+    // Nothing is bound before the scan, so there is nothing to join with.
+    if (left_op->GetTypeInfo() == Once::kType) return;
+    // Rows coming from other clauses are joined by the scan as before.
+    if (!IsPatternBranch(*left_op, *symbol_table_)) return;
+    auto left_symbols = left_op->ModifiedSymbols(*symbol_table_);
+    std::unordered_set<Symbol> left_symbols_set(left_symbols.begin(), left_symbols.end());
+
+    auto *condition = FindJoinCondition(expressions, left_symbols_set, right_bound, *symbol_table_);
+    if (!condition) continue;
+
+    chain[i]->set_input(std::make_shared<Once>());
+    auto right_op = chain.front();
+    auto right_symbols = right_op->ModifiedSymbols(*symbol_table_);
+    auto hash_join = std::make_shared<HashJoin>(left_op, left_symbols, right_op, right_symbols, condition);
+
+    filter.expression_ = RemoveAndExpressions(filter.expression_, {condition});
+    if (!filter.expression_ || filter.expression_ == condition) {
+      SetOnParent(hash_join);
+    } else {
+      filter.set_input(hash_join);
+    }
+    return;
+  }
+}
+
+}  // namespace impl
+
+std::unique_ptr<LogicalOperator> RewriteWithJoinRewriter(std::unique_ptr<LogicalOperator> root_op,
+                                                         SymbolTable *symbol_table) {
+  impl::JoinRewriter rewriter(symbol_table);
+  root_op->Accept(rewriter);
+  if (rewriter.new_root_) {
+    // This shouldn't happen in real use case, because a Filter can't be the
+    // root op. In case we somehow missed this, raise NotYetImplemented instead
+    // of MG_ASSERT crashing the application.
+    throw utils::NotYetImplemented("optimizing hash join");
+  }
+  return root_op;
+}
+
+}  // namespace memgraph::query::plan
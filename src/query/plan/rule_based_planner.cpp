@@ -480,7 +480,13 @@ std::unique_ptr<LogicalOperator> GenReturnBody(std::unique_ptr<LogicalOperator>
   // Like Where, OrderBy can read from symbols established by named expressions
   // in Produce, so it must come after it.
   if (!body.order_by().empty()) {
-    last_op = std::make_unique<OrderBy>(std::move(last_op), body.order_by(), body.output_symbols());
+    auto order_by = std::make_unique<OrderBy>(std::move(last_op), body.order_by(), body.output_symbols());
+    // With a LIMIT, OrderBy only needs to retain the first SKIP + LIMIT rows.
+    if (body.limit()) {
+      order_by->skip_ = body.skip();
+      order_by->limit_ = body.limit();
+    }
+    last_op = std::move(order_by);
   }
   // Finally, Skip and Limit must come after OrderBy.
   if (body.skip()) {
@@ -0,0 +1,84 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
+
+namespace memgraph::query::procedure {
+
+/// Read-only compressed sparse row snapshot of the out-edges of the graph,
+/// which is built by `mgp_graph_project_csr`.
+///
+/// Vertices are numbered from 0 in the order of `vertex_ids`. The
+/// out-neighbors of the i-th vertex are
+/// `neighbors[offsets[i]]..neighbors[offsets[i + 1] - 1]`, and `weights` is
+/// either empty or has the weight of each of those edges.
+///
+/// The arrays aren't allocated from the memory of a procedure call, because
+/// the projection can outlive it in the `CsrProjectionCache`.
+struct CsrProjection {
+  std::vector<int64_t> vertex_ids;
+  std::vector<size_t> offsets;
+  std::vector<size_t> neighbors;
+  std::vector<double> weights;
+};
+
+/// Defines which part of the graph is projected. Filters which aren't set
+/// match all vertices or edges.
+struct CsrProjectionKey {
+  std::optional<storage::LabelId> label;
+  std::optional<storage::EdgeTypeId> edge_type;
+  std::optional<storage::PropertyId> weight_property;
+  double default_weight{1.0};
+
+  friend bool operator<(const CsrProjectionKey &first, const CsrProjectionKey &second) {
+    return std::tie(first.label, first.edge_type, first.weight_property, first.default_weight) <
+           std::tie(second.label, second.edge_type, second.weight_property, second.default_weight);
+  }
+};
+
+/// Projections built during one command of a transaction.
+///
+/// Procedures which can't modify the graph read it as it was before the
+/// current command, so the same projection can be handed to all of them until
+/// the transaction advances to the next command.
+class CsrProjectionCache final {
+ public:
+  std::shared_ptr<const CsrProjection> Find(uint64_t command_id, const CsrProjectionKey &key) const {
+    if (command_id != command_id_) return nullptr;
+    auto it = projections_.find(key);
+    if (it == projections_.end()) return nullptr;
+    return it->second;
+  }
+
+  void Insert(uint64_t command_id, const CsrProjectionKey &key, std::shared_ptr<const CsrProjection> projection) {
+    if (command_id != command_id_) {
+      projections_.clear();
+      command_id_ = command_id;
+    }
+    projections_.insert_or_assign(key, std::move(projection));
+  }
+
+ private:
+  uint64_t command_id_{0};
+  std::map<CsrProjectionKey, std::shared_ptr<const CsrProjection>> projections_;
+};
+
+}  // namespace memgraph::query::procedure
@@ -20,8 +20,10 @@
 #include <regex>
 #include <stdexcept>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include "license/license.hpp"
 #include "mg_procedure.h"
@@ -2695,6 +2697,177 @@ mgp_error mgp_vertices_iterator_next(mgp_vertices_iterator *it, mgp_vertex **res
       result);
 }
 
+namespace {
+void AppendCsrEdge(CsrProjection &projection, std::vector<memgraph::storage::Gid> &targets,
+                   const memgraph::query::EdgeAccessor &edge, const CsrProjectionKey &key,
+                   const memgraph::storage::View view) {
+  if (key.edge_type && edge.EdgeType() != *key.edge_type) return;
+  if (key.weight_property) {
+    auto maybe_weight = edge.GetProperty(view, *key.weight_property);
+    if (maybe_weight.HasError()) {
+      throw DeletedObjectException{"Cannot get the weight of a deleted edge!"};
+    }
+    if (maybe_weight->IsNull()) {
+      projection.weights.push_back(key.default_weight);
+    } else if (maybe_weight->IsInt()) {
+      projection.weights.push_back(static_cast<double>(maybe_weight->ValueInt()));
+    } else if (maybe_weight->IsDouble()) {
+      projection.weights.push_back(maybe_weight->ValueDouble());
+    } else {
+      throw ValueConversionException{"The weight of an edge must be an integer or a double!"};
+    }
+  }
+  targets.push_back(edge.To().Gid());
+}
+
+// The vertices are numbered and their out-edges are read in a single pass.
+// Targets are kept as GIDs until all of the projected vertices are known, and
+// then the edges whose target wasn't projected are left out.
+std::shared_ptr<const CsrProjection> BuildCsrProjection(const mgp_graph &graph, const CsrProjectionKey &key) {
+  auto projection = std::make_shared<CsrProjection>();
+  std::vector<memgraph::storage::Gid> targets;
+  std::vector<size_t> target_offsets{0};
+  std::unordered_map<memgraph::storage::Gid, size_t> vertex_numbers;
+
+#ifdef MG_ENTERPRISE
+  const auto *auth_checker = graph.ctx && memgraph::license::global_license_checker.IsEnterpriseValidFast()
+                                 ? graph.ctx->auth_checker.get()
+                                 : nullptr;
+#endif
+
+  std::visit(
+      [&](auto *impl) {
+        for (auto vertex : impl->Vertices(graph.view)) {
+#ifdef MG_ENTERPRISE
+          if (auth_checker &&
+              !auth_checker->Has(vertex, graph.view, memgraph::query::AuthQuery::FineGrainedPrivilege::READ)) {
+            continue;
+          }
+#endif
+          if (key.label) {
+            auto maybe_has_label = vertex.HasLabel(graph.view, *key.label);
+            if (maybe_has_label.HasError()) {
+              throw DeletedObjectException{"Cannot get the labels of a deleted vertex!"};
+            }
+            if (!*maybe_has_label) continue;
+          }
+
+          vertex_numbers.emplace(vertex.Gid(), projection->vertex_ids.size());
+          projection->vertex_ids.push_back(vertex.Gid().AsInt());
+
+          auto append_edges = [&](auto &&maybe_edges) {
+            if (maybe_edges.HasError()) {
+              throw DeletedObjectException{"Cannot get the outbound edges of a deleted vertex!"};
+            }
+            for (const auto &edge : *maybe_edges) {
+#ifdef MG_ENTERPRISE
+              if (auth_checker && !auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ)) {
+                continue;
+              }
+#endif
+              AppendCsrEdge(*projection, targets, edge, key, graph.view);
+            }
+          };
+          if constexpr (std::is_same_v<decltype(impl), memgraph::query::DbAccessor *>) {
+            impl->PrefetchOutEdges(vertex);
+            append_edges(vertex.OutEdges(graph.view));
+          } else {
+            const memgraph::query::SubgraphVertexAccessor subgraph_vertex(vertex, impl->getGraph());
+            impl->PrefetchOutEdges(subgraph_vertex);
+            append_edges(subgraph_vertex.OutEdges(graph.view));
+          }
+          target_offsets.push_back(targets.size());
+        }
+      },
+      graph.impl);
+
+  const auto num_vertices = projection->vertex_ids.size();
+  projection->offsets.reserve(num_vertices + 1);
+  projection->offsets.push_back(0);
+  projection->neighbors.reserve(targets.size());
+  size_t num_weights = 0;
+  for (size_t i = 0; i < num_vertices; ++i) {
+    for (auto j = target_offsets[i]; j < target_offsets[i + 1]; ++j) {
+      auto it = vertex_numbers.find(targets[j]);
+      if (it == vertex_numbers.end()) continue;
+      projection->neighbors.push_back(it->second);
+      if (key.weight_property) {
+        projection->weights[num_weights++] = projection->weights[j];
+      }
+    }
+    projection->offsets.push_back(projection->neighbors.size());
+  }
+  projection->weights.resize(num_weights);
+  return projection;
+}
+}  // namespace
+
+mgp_error mgp_graph_project_csr(mgp_graph *graph, const char *label, const char *edge_type,
+                                const char *weight_property, double default_weight, mgp_memory *memory,
+                                mgp_csr_graph **result) {
+  return WrapExceptions(
+      [=] {
+        CsrProjectionKey key{.default_weight = default_weight};
+        std::visit(
+            [&](auto *impl) {
+              if (label) key.label = impl->NameToLabel(label);
+              if (edge_type) key.edge_type = impl->NameToEdgeType(edge_type);
+              if (weight_property) key.weight_property = impl->NameToProperty(weight_property);
+            },
+            graph->impl);
+
+        // Only the old view of the whole graph can't change until the next
+        // command, so only its projections are shared between the calls.
+        auto *db_accessor = graph->view == memgraph::storage::View::OLD &&
+                                    std::holds_alternative<memgraph::query::DbAccessor *>(graph->impl)
+                                ? std::get<memgraph::query::DbAccessor *>(graph->impl)
+                                : nullptr;
+        std::shared_ptr<const CsrProjection> projection;
+        if (db_accessor) {
+          projection = db_accessor->CsrProjections().Find(db_accessor->GetCommandId(), key);
+        }
+        if (!projection) {
+          projection = BuildCsrProjection(*graph, key);
+          if (db_accessor) {
+            db_accessor->CsrProjections().Insert(db_accessor->GetCommandId(), key, projection);
+          }
+        }
+        return NewRawMgpObject<mgp_csr_graph>(memory, std::move(projection));
+      },
+      result);
+}
+
+void mgp_csr_graph_destroy(mgp_csr_graph *csr) { DeleteRawMgpObject(csr); }
+
+mgp_error mgp_csr_graph_vertex_count(mgp_csr_graph *csr, size_t *result) {
+  return WrapExceptions([csr] { return csr->projection->vertex_ids.size(); }, result);
+}
+
+mgp_error mgp_csr_graph_edge_count(mgp_csr_graph *csr, size_t *result) {
+  return WrapExceptions([csr] { return csr->projection->neighbors.size(); }, result);
+}
+
+mgp_error mgp_csr_graph_vertex_ids(mgp_csr_graph *csr, const int64_t **result) {
+  return WrapExceptions([csr] { return csr->projection->vertex_ids.data(); }, result);
+}
+
+mgp_error mgp_csr_graph_offsets(mgp_csr_graph *csr, const size_t **result) {
+  return WrapExceptions([csr] { return csr->projection->offsets.data(); }, result);
+}
+
+mgp_error mgp_csr_graph_neighbors(mgp_csr_graph *csr, const size_t **result) {
+  return WrapExceptions([csr] { return csr->projection->neighbors.data(); }, result);
+}
+
+mgp_error mgp_csr_graph_weights(mgp_csr_graph *csr, const double **result) {
+  return WrapExceptions(
+      [csr]() -> const double * {
+        const auto &weights = csr->projection->weights;
+        return weights.empty() ? nullptr : weights.data();
+      },
+      result);
+}
+
 /// Type System
 ///
 /// All types are allocated globally, so that we simplify the API and minimize
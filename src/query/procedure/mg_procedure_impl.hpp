@@ -16,6 +16,7 @@
 
 #include "mg_procedure.h"
 
+#include <memory>
 #include <optional>
 #include <ostream>
 
@@ -24,6 +25,7 @@
 #include "query/context.hpp"
 #include "query/db_accessor.hpp"
 #include "query/frontend/ast/ast.hpp"
+#include "query/procedure/csr_projection.hpp"
 #include "query/procedure/cypher_type_ptr.hpp"
 #include "query/typed_value.hpp"
 #include "storage/v2/view.hpp"
@@ -713,6 +715,19 @@ struct mgp_vertices_iterator {
   std::optional<mgp_vertex> current_v;
 };
 
+struct mgp_csr_graph {
+  using allocator_type = memgraph::utils::Allocator<mgp_csr_graph>;
+
+  mgp_csr_graph(std::shared_ptr<const memgraph::query::procedure::CsrProjection> projection,
+                memgraph::utils::MemoryResource *memory)
+      : memory(memory), projection(std::move(projection)) {}
+
+  memgraph::utils::MemoryResource *GetMemoryResource() const { return memory; }
+
+  memgraph::utils::MemoryResource *memory;
+  std::shared_ptr<const memgraph::query::procedure::CsrProjection> projection;
+};
+
 struct mgp_type {
   memgraph::query::procedure::CypherTypePtr impl;
 };
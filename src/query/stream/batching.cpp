@@ -0,0 +1,90 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/stream/batching.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+
+#include <fmt/format.h>
+
+#include "query/frontend/ast/ast.hpp"
+#include "query/interpreter.hpp"
+#include "utils/exceptions.hpp"
+#include "utils/typeinfo.hpp"
+
+namespace memgraph::query::stream {
+
+std::optional<std::string> MakeBatchedQuery(const std::string_view query) {
+  auto batched_query = fmt::format("UNWIND ${} AS {} ", kBatchParameterName, kBatchRowName);
+  batched_query.reserve(batched_query.size() + query.size());
+  size_t pos = 0;
+  while (pos < query.size()) {
+    const auto current = query[pos];
+    auto end = pos + 1;
+    if (current == '\'' || current == '"' || current == '`') {
+      // Parameters aren't replaced inside of literals and escaped names.
+      while (end < query.size() && query[end] != current) {
+        end += (query[end] == '\\' && current != '`') ? 2 : 1;
+      }
+      end = std::min(end + 1, query.size());
+    } else if (query.substr(pos, 2) == "//") {
+      end = std::min(query.find('\n', pos), query.size());
+    } else if (query.substr(pos, 2) == "/*") {
+      end = query.find("*/", pos + 2);
+      end = end == std::string_view::npos ? query.size() : end + 2;
+    } else if (current == '$') {
+      while (end < query.size() && (std::isalnum(static_cast<unsigned char>(query[end])) || query[end] == '_')) {
+        ++end;
+      }
+      const auto name = query.substr(pos + 1, end - pos - 1);
+      if (name.empty() || std::isdigit(static_cast<unsigned char>(name.front()))) return std::nullopt;
+      fmt::format_to(std::back_inserter(batched_query), "{}.{}", kBatchRowName, name);
+      pos = end;
+      continue;
+    }
+    batched_query.append(query.substr(pos, end - pos));
+    pos = end;
+  }
+  return batched_query;
+}
+
+bool IsBatchedQueryValid(const std::string &batched_query, InterpreterContext *interpreter_context) {
+  try {
+    const auto parsed_query =
+        ParseQuery(batched_query, {{std::string{kBatchParameterName}, storage::PropertyValue()}},
+                   &interpreter_context->ast_cache, interpreter_context->config.query);
+    const auto *cypher_query = utils::Downcast<CypherQuery>(parsed_query.query);
+    if (!cypher_query || !cypher_query->cypher_unions_.empty()) return false;
+
+    // The first clause is the UNWIND of the batch. Clauses which combine or
+    // limit the rows of the whole query, like aggregations, ORDER BY, SKIP and
+    // LIMIT in RETURN and WITH, would see the rows of all of the executions
+    // at once, so only the clauses which work on each row on its own qualify.
+    bool has_update = false;
+    for (const auto *clause : cypher_query->single_query_->clauses_) {
+      const auto &type = clause->GetTypeInfo();
+      if (type == Match::kType || type == Unwind::kType) continue;
+      if (type != Create::kType && type != Merge::kType && type != Delete::kType && type != SetProperty::kType &&
+          type != SetProperties::kType && type != SetLabels::kType && type != RemoveProperty::kType &&
+          type != RemoveLabels::kType && type != Foreach::kType) {
+        return false;
+      }
+      has_update = true;
+    }
+    return has_update;
+  } catch (const utils::BasicException &) {
+    return false;
+  }
+}
+
+}  // namespace memgraph::query::stream
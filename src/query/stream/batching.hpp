@@ -0,0 +1,42 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace memgraph::query {
+struct InterpreterContext;
+}  // namespace memgraph::query
+
+namespace memgraph::query::stream {
+
+// Names of the parameter and the variable used by batched transformation queries.
+inline constexpr std::string_view kBatchParameterName{"__stream_batch"};
+inline constexpr std::string_view kBatchRowName{"__stream_row"};
+
+/// Rewrites a transformation query into a query which executes it once for
+/// every element of the batch parameter. Each element holds the parameters of
+/// one execution, so the parameters of the query are replaced with the fields
+/// of the current element. Returns `std::nullopt` if a parameter can't be
+/// replaced.
+std::optional<std::string> MakeBatchedQuery(std::string_view query);
+
+/// Returns true if executing the batched query once is equivalent to executing
+/// the original query once for every row of the batch. Only single-part Cypher
+/// queries made of MATCH, UNWIND and update clauses qualify; queries with
+/// RETURN or WITH (and with them aggregations, ORDER BY, SKIP and LIMIT),
+/// UNION, subqueries or procedure calls are executed once per row.
+bool IsBatchedQueryValid(const std::string &batched_query, InterpreterContext *interpreter_context);
+
+}  // namespace memgraph::query::stream
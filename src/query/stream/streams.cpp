@@ -11,6 +11,9 @@
 
 #include "query/stream/streams.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <optional>
 #include <shared_mutex>
 #include <string_view>
 #include <utility>
@@ -27,6 +30,7 @@
 #include "query/procedure/mg_procedure_helpers.hpp"
 #include "query/procedure/mg_procedure_impl.hpp"
 #include "query/procedure/module.hpp"
+#include "query/stream/batching.hpp"
 #include "query/stream/sources.hpp"
 #include "query/typed_value.hpp"
 #include "utils/event_counter.hpp"
@@ -81,6 +85,12 @@ std::pair<TypedValue /*query*/, TypedValue /*parameters*/> ExtractTransformation
   return {query_value, params_value};
 }
 
+bool HaveSameKeys(const std::map<std::string, storage::PropertyValue> &lhs,
+                  const std::map<std::string, storage::PropertyValue> &rhs) {
+  return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                    [](const auto &lhs_pair, const auto &rhs_pair) { return lhs_pair.first == rhs_pair.first; });
+}
+
 template <typename TMessage>
 void CallCustomTransformation(const std::string &transformation_name, const std::vector<TMessage> &messages,
                               mgp_result &result, storage::Storage::Accessor &storage_accessor,
@@ -487,7 +497,8 @@ Streams::StreamsMap::iterator Streams::CreateConsumer(StreamsMap &map, const std
                             interpreter = std::make_shared<Interpreter>(interpreter_context_),
                             result = mgp_result{nullptr, memory_resource},
                             total_retries = interpreter_context_->config.stream_transaction_conflict_retries,
-                            retry_interval = interpreter_context_->config.stream_transaction_retry_interval](
+                            retry_interval = interpreter_context_->config.stream_transaction_retry_interval,
+                            batch_queries = interpreter_context_->config.stream_transformation_batching](
                                const std::vector<typename TStream::Message> &messages) mutable {
     auto accessor = interpreter_context->db->Access();
     // register new interpreter into interpreter_context_
@@ -506,20 +517,56 @@ Streams::StreamsMap::iterator Streams::CreateConsumer(StreamsMap &map, const std
       interpreter->Abort();
     }};
 
-    const static std::map<std::string, storage::PropertyValue> empty_parameters{};
+    std::vector<std::pair<std::string, std::map<std::string, storage::PropertyValue>>> queries;
+    queries.reserve(result.rows.size());
+    for (auto &row : result.rows) {
+      auto [query_value, params_value] = ExtractTransformationResult(row.values, transformation_name, stream_name);
+      storage::PropertyValue params_prop{params_value};
+      queries.emplace_back(query_value.ValueString(),
+                           params_prop.IsNull() ? empty_parameters : std::move(params_prop.ValueMap()));
+    }
+
+    // Consecutive rows with the same query are executed as a single query
+    // which unwinds their parameters, so the query is parsed and planned once
+    // for the whole group instead of once for every row.
+    std::vector<std::pair<std::string, std::map<std::string, storage::PropertyValue>>> batched_queries;
+    for (auto group_begin = queries.begin(); group_begin != queries.end();) {
+      auto group_end = std::next(group_begin);
+      if (batch_queries) {
+        group_end = std::find_if(group_end, queries.end(), [&](const auto &query) {
+          return query.first != group_begin->first || !HaveSameKeys(query.second, group_begin->second);
+        });
+      }
+      std::optional<std::string> batched_query;
+      if (std::distance(group_begin, group_end) > 1) {
+        batched_query = MakeBatchedQuery(group_begin->first);
+        if (batched_query && !IsBatchedQueryValid(*batched_query, interpreter_context)) {
+          batched_query.reset();
+        }
+      }
+      if (!batched_query) {
+        std::move(group_begin, group_end, std::back_inserter(batched_queries));
+        group_begin = group_end;
+        continue;
+      }
+      std::vector<storage::PropertyValue> batch;
+      batch.reserve(std::distance(group_begin, group_end));
+      for (; group_begin != group_end; ++group_begin) {
+        batch.emplace_back(std::move(group_begin->second));
+      }
+      batched_queries.emplace_back(
+          std::move(*batched_query),
+          std::map<std::string, storage::PropertyValue>{
+              {std::string{kBatchParameterName}, storage::PropertyValue(std::move(batch))}});
+    }
+
     uint32_t i = 0;
     while (true) {
       try {
         interpreter->BeginTransaction();
-        for (auto &row : result.rows) {
-          spdlog::trace("Processing row in stream '{}'", stream_name);
-          auto [query_value, params_value] = ExtractTransformationResult(row.values, transformation_name, stream_name);
-          storage::PropertyValue params_prop{params_value};
-
-          std::string query{query_value.ValueString()};
+        for (const auto &[query, params] : batched_queries) {
           spdlog::trace("Executing query '{}' in stream '{}'", query, stream_name);
-          auto prepare_result =
-              interpreter->Prepare(query, params_prop.IsNull() ? empty_parameters : params_prop.ValueMap(), nullptr);
+          auto prepare_result = interpreter->Prepare(query, params, nullptr);
           if (!interpreter_context->auth_checker->IsUserAuthorized(owner, prepare_result.privileges, "")) {
             throw StreamsException{
                 "Couldn't execute query '{}' for stream '{}' because the owner is not authorized to execute the "
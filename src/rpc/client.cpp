@@ -1,4 +1,4 @@
-// Copyright 2022 Memgraph Ltd.
+// Copyright 2023 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -17,11 +17,125 @@ Client::Client(const io::network::Endpoint &endpoint, communication::ClientConte
     : endpoint_(endpoint), context_(context) {}
 
 void Client::Abort() {
+  // A request which is being written holds `mutex_`, so the connection can be
+  // destroyed only if the lock is free. Waiting for it could block until the
+  // write this call is supposed to abort finishes.
+  std::unique_lock<std::mutex> write_guard(mutex_, std::try_to_lock);
+  std::lock_guard<std::mutex> guard(response_mutex_);
   if (!client_) return;
   // We need to call Shutdown on the client to abort any pending read or
   // write operations.
+  broken_ = true;
   client_->Shutdown();
-  client_ = std::nullopt;
+  response_cv_.notify_all();
+  // Otherwise the connection is still used and it's replaced by the next call
+  // once all of the calls in flight fail.
+  if (write_guard.owns_lock() && in_flight_ == 0) client_ = std::nullopt;
+}
+
+void Client::Connect() {
+  std::lock_guard<std::mutex> guard(response_mutex_);
+
+  // Check if the connection is broken (if we haven't used the client for a
+  // long time the server could have died).
+  if (client_ && (broken_ || client_->ErrorStatus())) {
+    // The calls in flight still wait on the connection and fail by themselves.
+    if (in_flight_ > 0) throw RpcFailedException(endpoint_);
+    client_ = std::nullopt;
+  }
+
+  // Connect to the remote server.
+  if (!client_) {
+    // The connection was aborted while calls were in flight.
+    if (in_flight_ > 0) throw RpcFailedException(endpoint_);
+    next_ticket_ = 0;
+    next_response_ = 0;
+    broken_ = false;
+    responses_.clear();
+    abandoned_.clear();
+
+    client_.emplace(context_);
+    if (!client_->Connect(endpoint_)) {
+      SPDLOG_ERROR("Couldn't connect to remote address {}", endpoint_);
+      client_ = std::nullopt;
+      throw RpcFailedException(endpoint_);
+    }
+  }
+}
+
+uint64_t Client::RequestSent() {
+  std::lock_guard<std::mutex> guard(response_mutex_);
+  ++in_flight_;
+  return next_ticket_++;
+}
+
+std::vector<uint8_t> Client::ReceiveResponse(uint64_t ticket) {
+  std::unique_lock<std::mutex> guard(response_mutex_);
+  utils::OnScopeExit done([this] { --in_flight_; });
+  while (true) {
+    if (auto it = responses_.find(ticket); it != responses_.end()) {
+      auto data = std::move(it->second);
+      responses_.erase(it);
+      return data;
+    }
+    if (broken_) throw RpcFailedException(endpoint_);
+    if (reading_) {
+      response_cv_.wait(guard);
+      continue;
+    }
+
+    // Nobody is reading, so this thread reads the next response, even if it
+    // belongs to another ticket.
+    reading_ = true;
+    const auto response_ticket = next_response_;
+    guard.unlock();
+    auto data = ReadResponse();
+    guard.lock();
+    reading_ = false;
+    if (data) {
+      ++next_response_;
+      if (abandoned_.erase(response_ticket) == 0) {
+        responses_.emplace(response_ticket, std::move(*data));
+      }
+    } else {
+      broken_ = true;
+      if (client_) client_->Shutdown();
+    }
+    response_cv_.notify_all();
+  }
+}
+
+void Client::AbandonResponse(uint64_t ticket) {
+  std::lock_guard<std::mutex> guard(response_mutex_);
+  --in_flight_;
+  if (responses_.erase(ticket) == 0 && ticket >= next_response_) {
+    abandoned_.insert(ticket);
+  }
+}
+
+std::optional<std::vector<uint8_t>> Client::ReadResponse() {
+  while (true) {
+    auto ret = slk::CheckStreamComplete(client_->GetData(), client_->GetDataSize());
+    if (ret.status == slk::StreamStatus::INVALID) {
+      return std::nullopt;
+    } else if (ret.status == slk::StreamStatus::PARTIAL) {
+      if (!client_->Read(ret.stream_size - client_->GetDataSize(),
+                         /* exactly_len = */ false)) {
+        return std::nullopt;
+      }
+    } else {
+      std::vector<uint8_t> data(client_->GetData(), client_->GetData() + ret.stream_size);
+      client_->ShiftData(ret.stream_size);
+      return data;
+    }
+  }
+}
+
+void Client::MarkBroken() {
+  std::lock_guard<std::mutex> guard(response_mutex_);
+  broken_ = true;
+  if (client_) client_->Shutdown();
+  response_cv_.notify_all();
 }
 
 }  // namespace memgraph::rpc
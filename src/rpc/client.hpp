@@ -11,9 +11,16 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <set>
+#include <utility>
+#include <vector>
 
 #include "communication/client.hpp"
 #include "io/network/endpoint.hpp"
@@ -28,6 +35,17 @@
 namespace memgraph::rpc {
 
 /// Client is thread safe, but it is recommended to use thread_local clients.
+///
+/// Calls can be pipelined: a request is sent as soon as it is finalized, and
+/// other requests can be sent on the same connection before its response is
+/// received. The server answers the requests of a connection in the order in
+/// which they were sent, so every sent request gets a ticket and the responses
+/// are matched to the tickets in the same order. The responses can be awaited
+/// in any order and from any thread.
+///
+/// OpenSSL doesn't allow reading and writing an SSL connection at the same
+/// time, so with SSL every response is received before the next request can
+/// be sent, like before pipelining was added.
 class Client {
  public:
   Client(const io::network::Endpoint &endpoint, communication::ClientContext *context);
@@ -43,47 +61,78 @@ class Client {
         : self_(self),
           guard_(std::move(guard)),
           req_builder_([self](const uint8_t *data, size_t size, bool have_more) {
-            if (!self->client_->Write(data, size, have_more)) throw RpcFailedException(self->endpoint_);
+            if (!self->client_->Write(data, size, have_more)) {
+              self->MarkBroken();
+              throw RpcFailedException(self->endpoint_);
+            }
           }),
           res_load_(res_load) {}
 
    public:
-    StreamHandler(StreamHandler &&) noexcept = default;
-    StreamHandler &operator=(StreamHandler &&) noexcept = default;
+    StreamHandler(StreamHandler &&other) noexcept
+        : self_(other.self_),
+          guard_(std::move(other.guard_)),
+          req_builder_(std::move(other.req_builder_)),
+          res_load_(std::move(other.res_load_)),
+          ticket_(std::exchange(other.ticket_, std::nullopt)),
+          response_(std::move(other.response_)) {}
+
+    StreamHandler &operator=(StreamHandler &&other) noexcept {
+      if (this != &other) {
+        Abandon();
+        self_ = other.self_;
+        guard_ = std::move(other.guard_);
+        req_builder_ = std::move(other.req_builder_);
+        res_load_ = std::move(other.res_load_);
+        ticket_ = std::exchange(other.ticket_, std::nullopt);
+        response_ = std::move(other.response_);
+      }
+      return *this;
+    }
 
     StreamHandler(const StreamHandler &) = delete;
     StreamHandler &operator=(const StreamHandler &) = delete;
 
-    ~StreamHandler() {}
+    ~StreamHandler() { Abandon(); }
 
     slk::Builder *GetBuilder() { return &req_builder_; }
 
-    typename TRequestResponse::Response AwaitResponse() {
-      auto res_type = TRequestResponse::Response::kType;
+    /// Finalizes the request and sends it to the server without waiting for
+    /// the response, so that the client can send other requests in the
+    /// meantime. Nothing can be added to the request afterwards. Calling it
+    /// more than once has no effect.
+    ///
+    /// @throws RpcFailedException if the request couldn't be sent
+    void Send() {
+      if (!guard_.owns_lock()) return;
 
       // Finalize the request.
       req_builder_.Finalize();
 
+      const auto ticket = self_->RequestSent();
+      if (self_->context_->use_ssl()) {
+        response_ = self_->ReceiveResponse(ticket);
+      } else {
+        ticket_ = ticket;
+      }
+      guard_.unlock();
+    }
+
+    typename TRequestResponse::Response AwaitResponse() {
+      auto res_type = TRequestResponse::Response::kType;
+
+      Send();
+
       // Receive the response.
-      uint64_t response_data_size = 0;
-      while (true) {
-        auto ret = slk::CheckStreamComplete(self_->client_->GetData(), self_->client_->GetDataSize());
-        if (ret.status == slk::StreamStatus::INVALID) {
-          throw RpcFailedException(self_->endpoint_);
-        } else if (ret.status == slk::StreamStatus::PARTIAL) {
-          if (!self_->client_->Read(ret.stream_size - self_->client_->GetDataSize(),
-                                    /* exactly_len = */ false)) {
-            throw RpcFailedException(self_->endpoint_);
-          }
-        } else {
-          response_data_size = ret.stream_size;
-          break;
-        }
+      if (ticket_) {
+        response_ = self_->ReceiveResponse(*std::exchange(ticket_, std::nullopt));
       }
+      MG_ASSERT(response_, "The response of an RPC call can be awaited only once");
+      const auto response_data = std::move(*response_);
+      response_ = std::nullopt;
 
       // Load the response.
-      slk::Reader res_reader(self_->client_->GetData(), response_data_size);
-      utils::OnScopeExit res_cleanup([&, response_data_size] { self_->client_->ShiftData(response_data_size); });
+      slk::Reader res_reader(response_data.data(), response_data.size());
 
       utils::TypeId res_id{utils::TypeId::UNKNOWN};
       slk::Load(&res_id, &res_reader);
@@ -91,7 +140,7 @@ class Client {
       // Check the response ID.
       if (res_id != res_type.id && res_id != utils::TypeId::UNKNOWN) {
         spdlog::error("Message response was of unexpected type");
-        self_->client_ = std::nullopt;
+        self_->MarkBroken();
         throw RpcFailedException(self_->endpoint_);
       }
 
@@ -101,17 +150,25 @@ class Client {
     }
 
    private:
+    void Abandon() {
+      if (ticket_) self_->AbandonResponse(*std::exchange(ticket_, std::nullopt));
+    }
+
     Client *self_;
     std::unique_lock<std::mutex> guard_;
     slk::Builder req_builder_;
     std::function<typename TRequestResponse::Response(slk::Reader *)> res_load_;
+    // Set while the request is sent and its response wasn't received yet.
+    std::optional<uint64_t> ticket_;
+    std::optional<std::vector<uint8_t>> response_;
   };
 
   /// Stream a previously defined and registered RPC call. This function can
-  /// initiate only one request at a time. The call returns a `StreamHandler`
-  /// object that can be used to send additional data to the request (with the
-  /// automatically sent `TRequestResponse::Request` object) and await until the
-  /// response is received from the server.
+  /// initiate only one request at a time; the next request can be initiated
+  /// once the `StreamHandler` sends the request. The call returns a
+  /// `StreamHandler` object that can be used to send additional data to the
+  /// request (with the automatically sent `TRequestResponse::Request` object)
+  /// and await until the response is received from the server.
   ///
   /// @returns StreamHandler<TRequestResponse> object that is used to handle
   ///                                          streaming of additional data to
@@ -141,21 +198,7 @@ class Client {
 
     std::unique_lock<std::mutex> guard(mutex_);
 
-    // Check if the connection is broken (if we haven't used the client for a
-    // long time the server could have died).
-    if (client_ && client_->ErrorStatus()) {
-      client_ = std::nullopt;
-    }
-
-    // Connect to the remote server.
-    if (!client_) {
-      client_.emplace(context_);
-      if (!client_->Connect(endpoint_)) {
-        SPDLOG_ERROR("Couldn't connect to remote address {}", endpoint_);
-        client_ = std::nullopt;
-        throw RpcFailedException(endpoint_);
-      }
-    }
+    Connect();
 
     // Create the stream handler.
     StreamHandler<TRequestResponse> handler(this, std::move(guard), load);
@@ -168,9 +211,8 @@ class Client {
     return std::move(handler);
   }
 
-  /// Call a previously defined and registered RPC call. This function can
-  /// initiate only one request at a time. The call blocks until a response is
-  /// received.
+  /// Call a previously defined and registered RPC call. The call blocks until
+  /// a response is received.
   ///
   /// @returns TRequestResponse::Response object that was specified to be
   ///                                     returned by the RPC call
@@ -191,17 +233,80 @@ class Client {
     return stream.AwaitResponse();
   }
 
+  /// Send a previously defined and registered RPC call without waiting for
+  /// the response. The response is received with `AwaitResponse` on the
+  /// returned `StreamHandler`, and dropping the handler discards it.
+  ///
+  /// The server stops reading requests while it can't send the responses, so
+  /// the number of calls in flight should be bounded by the caller.
+  ///
+  /// @returns StreamHandler<TRequestResponse> object whose request was
+  ///                                          already sent
+  /// @throws RpcFailedException if an error was occurred while sending the
+  ///                            RPC call
+  template <class TRequestResponse, class... Args>
+  StreamHandler<TRequestResponse> CallAsync(Args &&...args) {
+    auto stream = Stream<TRequestResponse>(std::forward<Args>(args)...);
+    stream.Send();
+    return stream;
+  }
+
   /// Call this function from another thread to abort a pending RPC call.
   void Abort();
 
   const auto &Endpoint() const { return endpoint_; }
 
  private:
+  /// Reconnects if the connection is broken. Must be called while holding
+  /// `mutex_`.
+  ///
+  /// @throws RpcFailedException if the connection couldn't be established or
+  ///                            if the broken connection still has calls in
+  ///                            flight
+  void Connect();
+
+  /// Returns the ticket of the request which was just sent. Must be called
+  /// while holding `mutex_`, so that the tickets are in the order in which
+  /// the requests were sent.
+  uint64_t RequestSent();
+
+  /// Blocks until the response to the request with the given ticket is
+  /// received and returns its data.
+  ///
+  /// @throws RpcFailedException if the connection failed
+  std::vector<uint8_t> ReceiveResponse(uint64_t ticket);
+
+  /// Discards the response to the request with the given ticket.
+  void AbandonResponse(uint64_t ticket);
+
+  /// Reads the next response from the connection. Only one thread can read
+  /// at a time.
+  std::optional<std::vector<uint8_t>> ReadResponse();
+
+  /// Fails all of the calls in flight and makes the next call reconnect.
+  void MarkBroken();
+
   io::network::Endpoint endpoint_;
   communication::ClientContext *context_;
   std::optional<communication::Client> client_;
 
+  // Held while a request is written.
   std::mutex mutex_;
+
+  // Protects everything below. It is locked after `mutex_` when both are
+  // needed.
+  std::mutex response_mutex_;
+  std::condition_variable response_cv_;
+  uint64_t next_ticket_{0};
+  // Ticket of the next response which will be read from the connection.
+  uint64_t next_response_{0};
+  // Number of sent requests whose responses weren't received or abandoned.
+  uint64_t in_flight_{0};
+  bool reading_{false};
+  bool broken_{false};
+  // Responses which were read by another thread than the one awaiting them.
+  std::map<uint64_t, std::vector<uint8_t>> responses_;
+  std::set<uint64_t> abandoned_;
 };
 
 }  // namespace memgraph::rpc
@@ -25,12 +25,17 @@ Session::Session(Server *server, const io::network::Endpoint &endpoint, communic
     : server_(server), endpoint_(endpoint), input_stream_(input_stream), output_stream_(output_stream) {}
 
 void Session::Execute() {
+  while (ExecuteRequest()) {
+  }
+}
+
+bool Session::ExecuteRequest() {
   auto ret = slk::CheckStreamComplete(input_stream_->data(), input_stream_->size());
   if (ret.status == slk::StreamStatus::INVALID) {
     throw SessionException("Received an invalid SLK stream!");
   } else if (ret.status == slk::StreamStatus::PARTIAL) {
     input_stream_->Resize(ret.stream_size);
-    return;
+    return false;
   }
 
   // Remove the data from the stream on scope exit.
@@ -75,6 +80,7 @@ void Session::Execute() {
 
   SPDLOG_TRACE("[RpcServer] sent {}",
                (it != server_->callbacks_.end() ? it->second.res_type.name : extended_it->second.res_type.name));
+  return true;
 }
 
 }  // namespace memgraph::rpc
@@ -54,10 +54,17 @@ class Session {
    * Executes the protocol after data has been read into the stream.
    * Goes through the protocol states in order to execute commands from the
    * client.
+   *
+   * Clients can pipeline requests, so all of the complete requests which are
+   * in the stream are executed, in the order in which they were received.
    */
   void Execute();
 
  private:
+  /// Executes the first request in the stream. Returns `false` if the stream
+  /// doesn't contain a complete request.
+  bool ExecuteRequest();
+
   Server *server_;
   io::network::Endpoint endpoint_;
   communication::InputStream *input_stream_;
@@ -53,6 +53,9 @@ struct Config {
 
     uint64_t wal_file_size_kibibytes{20 * 1024};
     uint64_t wal_file_flush_every_n_tx{100000};
+    // Upper bound on how long written transactions can wait for the WAL to be
+    // synced. Zero disables the periodic sync.
+    std::chrono::milliseconds wal_file_flush_interval{std::chrono::milliseconds::zero()};
 
     bool snapshot_on_exit{false};
     bool restore_replication_state_on_startup{false};
@@ -61,6 +64,9 @@ struct Config {
     uint64_t recovery_thread_count{8};
 
     bool allow_parallel_index_creation{false};
+
+    bool allow_parallel_snapshot_creation{false};
+    uint64_t snapshot_thread_count{8};
   } durability;
 
   struct Transaction {
@@ -76,6 +82,21 @@ struct Config {
     std::filesystem::path id_name_mapper_directory{"storage/rocksdb_id_name_mapper"};
     std::filesystem::path durability_directory{"storage/rocksdb_durability"};
     std::filesystem::path wal_directory{"storage/rocksdb_wal"};
+
+    enum class Compression { NONE, LZ4, ZSTD };
+
+    // Compression of the data files. The RocksDB WAL is compressed only with
+    // ZSTD because RocksDB doesn't support other algorithms for it.
+    Compression compression{Compression::NONE};
+    // Size of the block cache. There is a single block cache in the process,
+    // shared by the RocksDB instances of every on-disk database, and its
+    // capacity is the one of the database configured last. Zero keeps the
+    // default 8MiB cache of every instance.
+    uint64_t block_cache_size_mib{0};
+    // Zero disables the bloom filters.
+    uint64_t bloom_filter_bits_per_key{10};
+    // Bypasses the page cache for reads, flushes and compactions.
+    bool use_direct_io{false};
   } disk;
 
   std::string name;
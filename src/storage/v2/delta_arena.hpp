@@ -0,0 +1,178 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/delta.hpp"
+
+namespace memgraph::storage {
+
+/// Container which owns all of the deltas created by a transaction.
+///
+/// Deltas are constructed in place inside of chunks which are allocated with
+/// geometrically growing capacity, so creating a delta doesn't allocate in the
+/// common case and the deltas of a transaction are laid out next to each
+/// other. A delta never moves after it is created, which keeps the pointers
+/// stored in the MVCC chains valid for as long as the arena lives, even after
+/// the arena itself is moved into the garbage collector. When the arena is
+/// destroyed all deltas are destroyed and their chunks are released at once.
+class DeltaArena final {
+  struct Chunk {
+    Delta *data;
+    size_t size;
+    size_t capacity;
+  };
+
+ public:
+  /// Capacity of the first chunk. Most transactions create only a few deltas,
+  /// so we don't want to preallocate much memory for them.
+  static constexpr size_t kInitialChunkCapacity = 8;
+  /// Largest capacity of a single chunk.
+  static constexpr size_t kMaxChunkCapacity = 8192;
+
+  template <bool IsConst>
+  class Iterator final {
+    using TChunks = std::conditional_t<IsConst, const std::vector<Chunk>, std::vector<Chunk>>;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Delta;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const Delta *, Delta *>;
+    using reference = std::conditional_t<IsConst, const Delta &, Delta &>;
+
+    Iterator() = default;
+
+    reference operator*() const { return (*chunks_)[chunk_].data[pos_]; }
+    pointer operator->() const { return &(*chunks_)[chunk_].data[pos_]; }
+
+    Iterator &operator++() {
+      if (++pos_ == (*chunks_)[chunk_].size) {
+        ++chunk_;
+        pos_ = 0;
+      }
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto old = *this;
+      ++*this;
+      return old;
+    }
+
+    bool operator==(const Iterator &other) const { return chunk_ == other.chunk_ && pos_ == other.pos_; }
+
+   private:
+    friend class DeltaArena;
+
+    Iterator(TChunks *chunks, size_t chunk, size_t pos) : chunks_(chunks), chunk_(chunk), pos_(pos) {}
+
+    TChunks *chunks_{nullptr};
+    size_t chunk_{0};
+    size_t pos_{0};
+  };
+
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  DeltaArena() = default;
+
+  DeltaArena(DeltaArena &&other) noexcept
+      : chunks_(std::exchange(other.chunks_, {})), size_(std::exchange(other.size_, 0)) {}
+
+  DeltaArena &operator=(DeltaArena &&other) noexcept {
+    if (this == &other) return *this;
+    clear();
+    chunks_ = std::exchange(other.chunks_, {});
+    size_ = std::exchange(other.size_, 0);
+    return *this;
+  }
+
+  DeltaArena(const DeltaArena &) = delete;
+  DeltaArena &operator=(const DeltaArena &) = delete;
+
+  ~DeltaArena() { clear(); }
+
+  /// Constructs a new delta at the end of the arena and returns a reference
+  /// to it. The reference stays valid until the arena is cleared or destroyed.
+  /// @throw std::bad_alloc
+  template <typename... Args>
+  Delta &emplace_back(Args &&...args) {
+    if (chunks_.empty() || chunks_.back().size == chunks_.back().capacity) {
+      AllocateChunk();
+    }
+    auto &chunk = chunks_.back();
+    Delta *delta = nullptr;
+    try {
+      delta = std::construct_at(chunk.data + chunk.size, std::forward<Args>(args)...);
+    } catch (...) {
+      // Iteration relies on every chunk holding at least one delta.
+      if (chunk.size == 0) {
+        std::allocator<Delta>().deallocate(chunk.data, chunk.capacity);
+        chunks_.pop_back();
+      }
+      throw;
+    }
+    ++chunk.size;
+    ++size_;
+    return *delta;
+  }
+
+  bool empty() const { return size_ == 0; }
+  size_t size() const { return size_; }
+
+  /// Destroys all deltas and releases the memory of all chunks.
+  void clear() {
+    std::allocator<Delta> allocator;
+    for (auto &chunk : chunks_) {
+      std::destroy_n(chunk.data, chunk.size);
+      allocator.deallocate(chunk.data, chunk.capacity);
+    }
+    chunks_.clear();
+    size_ = 0;
+  }
+
+  iterator begin() { return {&chunks_, 0, 0}; }
+  iterator end() { return {&chunks_, EndChunk(), 0}; }
+  const_iterator begin() const { return {&chunks_, 0, 0}; }
+  const_iterator end() const { return {&chunks_, EndChunk(), 0}; }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+ private:
+  void AllocateChunk() {
+    const auto capacity =
+        chunks_.empty() ? kInitialChunkCapacity : std::min(chunks_.back().capacity * 2, kMaxChunkCapacity);
+    // Reserve the slot first so that pushing the chunk can't throw after the
+    // memory has been allocated.
+    if (chunks_.size() == chunks_.capacity()) {
+      chunks_.reserve(std::max<size_t>(chunks_.size() * 2, 4));
+    }
+    chunks_.push_back({.data = std::allocator<Delta>().allocate(capacity), .size = 0, .capacity = capacity});
+  }
+
+  // Only the last chunk may be partially filled and no chunk is ever empty, so
+  // the past-the-end position is the start of the chunk after the last one.
+  size_t EndChunk() const { return chunks_.size(); }
+
+  std::vector<Chunk> chunks_;
+  size_t size_{0};
+};
+
+}  // namespace memgraph::storage
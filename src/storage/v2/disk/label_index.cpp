@@ -9,6 +9,9 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <algorithm>
+#include <iterator>
+
 #include <rocksdb/options.h>
 #include <rocksdb/utilities/transaction.h>
 
@@ -51,6 +54,7 @@ DiskLabelIndex::DiskLabelIndex(Indices *indices, Constraints *constraints, const
   kvstore_ = std::make_unique<RocksDBStorage>();
   kvstore_->options_.create_if_missing = true;
   kvstore_->options_.comparator = new ComparatorWithU64TsImpl();
+  ApplyDiskConfig(kvstore_->options_, config.disk);
   logging::AssertRocksDBStatus(rocksdb::TransactionDB::Open(kvstore_->options_, rocksdb::TransactionDBOptions(),
                                                             config.disk.label_index_directory, &kvstore_->db_));
 }
@@ -184,6 +188,7 @@ bool DiskLabelIndex::DropIndex(LabelId label) {
   if (!(index_.erase(label) > 0)) {
     return false;
   }
+  stats_.erase(label);
   auto disk_transaction = CreateAllReadingRocksDBTransaction();
 
   rocksdb::ReadOptions ro;
@@ -205,7 +210,12 @@ bool DiskLabelIndex::IndexExists(LabelId label) const { return index_.find(label
 
 std::vector<LabelId> DiskLabelIndex::ListIndices() const { return {index_.begin(), index_.end()}; }
 
-uint64_t DiskLabelIndex::ApproximateVertexCount(LabelId /*label*/) const { return 10; }
+uint64_t DiskLabelIndex::ApproximateVertexCount(LabelId label) const {
+  if (auto it = stats_.find(label); it != stats_.end()) {
+    return it->second.count;
+  }
+  return 10;
+}
 
 void DiskLabelIndex::LoadIndexInfo(const std::vector<std::string> &labels) {
   for (const std::string &label : labels) {
@@ -216,4 +226,32 @@ void DiskLabelIndex::LoadIndexInfo(const std::vector<std::string> &labels) {
 
 RocksDBStorage *DiskLabelIndex::GetRocksDBStorage() const { return kvstore_.get(); }
 
+void DiskLabelIndex::SetIndexStats(const storage::LabelId &label, const storage::LabelIndexStats &stats) {
+  stats_[label] = stats;
+}
+
+std::optional<LabelIndexStats> DiskLabelIndex::GetIndexStats(const storage::LabelId &label) const {
+  if (auto it = stats_.find(label); it != stats_.end()) {
+    return it->second;
+  }
+  return {};
+}
+
+std::vector<LabelId> DiskLabelIndex::ClearIndexStats() {
+  std::vector<LabelId> deleted_indexes;
+  deleted_indexes.reserve(stats_.size());
+  std::transform(stats_.begin(), stats_.end(), std::back_inserter(deleted_indexes),
+                 [](const auto &elem) { return elem.first; });
+  stats_.clear();
+  return deleted_indexes;
+}
+
+std::vector<LabelId> DiskLabelIndex::DeleteIndexStats(const storage::LabelId &label) {
+  std::vector<LabelId> deleted_indexes;
+  if (stats_.erase(label) > 0) {
+    deleted_indexes.push_back(label);
+  }
+  return deleted_indexes;
+}
+
 }  // namespace memgraph::storage
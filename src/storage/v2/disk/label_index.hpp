@@ -47,15 +47,26 @@ class DiskLabelIndex : public storage::LabelIndex {
 
   std::vector<LabelId> ListIndices() const override;
 
+  /// Returns the number of vertices from the index statistics, or a
+  /// constant estimate if the label wasn't analyzed.
   uint64_t ApproximateVertexCount(LabelId label) const override;
 
   RocksDBStorage *GetRocksDBStorage() const;
 
   void LoadIndexInfo(const std::vector<std::string> &labels);
 
+  void SetIndexStats(const storage::LabelId &label, const storage::LabelIndexStats &stats);
+
+  std::optional<storage::LabelIndexStats> GetIndexStats(const storage::LabelId &label) const;
+
+  std::vector<LabelId> ClearIndexStats();
+
+  std::vector<LabelId> DeleteIndexStats(const storage::LabelId &label);
+
  private:
   utils::Synchronized<std::map<uint64_t, std::map<Gid, std::vector<LabelId>>>> entries_for_deletion;
   std::unordered_set<LabelId> index_;
+  std::map<LabelId, storage::LabelIndexStats> stats_;
   std::unique_ptr<RocksDBStorage> kvstore_;
 };
 
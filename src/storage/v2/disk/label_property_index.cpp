@@ -11,6 +11,10 @@
 
 /// TODO: clear dependencies
 
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
 #include "storage/v2/disk/label_property_index.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/inmemory/indices_utils.hpp"
@@ -60,6 +64,7 @@ DiskLabelPropertyIndex::DiskLabelPropertyIndex(Indices *indices, Constraints *co
   kvstore_ = std::make_unique<RocksDBStorage>();
   kvstore_->options_.create_if_missing = true;
   kvstore_->options_.comparator = new ComparatorWithU64TsImpl();
+  ApplyDiskConfig(kvstore_->options_, config.disk);
   logging::AssertRocksDBStatus(rocksdb::TransactionDB::Open(
       kvstore_->options_, rocksdb::TransactionDBOptions(), config.disk.label_property_index_directory, &kvstore_->db_));
 }
@@ -194,7 +199,11 @@ void DiskLabelPropertyIndex::UpdateOnSetProperty(PropertyId property, const Prop
                                                  const Transaction &tx) {}
 
 bool DiskLabelPropertyIndex::DropIndex(LabelId label, PropertyId property) {
-  return index_.erase({label, property}) > 0;
+  if (!(index_.erase({label, property}) > 0)) {
+    return false;
+  }
+  stats_.erase({label, property});
+  return true;
 }
 
 bool DiskLabelPropertyIndex::IndexExists(LabelId label, PropertyId property) const {
@@ -205,16 +214,29 @@ std::vector<std::pair<LabelId, PropertyId>> DiskLabelPropertyIndex::ListIndices(
   return {index_.begin(), index_.end()};
 }
 
-uint64_t DiskLabelPropertyIndex::ApproximateVertexCount(LabelId /*label*/, PropertyId /*property*/) const { return 10; }
+uint64_t DiskLabelPropertyIndex::ApproximateVertexCount(LabelId label, PropertyId property) const {
+  if (auto stats = GetIndexStats({label, property})) {
+    return stats->count;
+  }
+  return 10;
+}
 
-uint64_t DiskLabelPropertyIndex::ApproximateVertexCount(LabelId /*label*/, PropertyId /*property*/,
+uint64_t DiskLabelPropertyIndex::ApproximateVertexCount(LabelId label, PropertyId property,
                                                         const PropertyValue & /*value*/) const {
+  // Without a histogram of the values every value is expected to be as
+  // common as the average one.
+  if (auto stats = GetIndexStats({label, property})) {
+    return static_cast<uint64_t>(std::ceil(stats->avg_group_size));
+  }
   return 10;
 }
 
 uint64_t DiskLabelPropertyIndex::ApproximateVertexCount(
-    LabelId /*label*/, PropertyId /*property*/, const std::optional<utils::Bound<PropertyValue>> & /*lower*/,
+    LabelId label, PropertyId property, const std::optional<utils::Bound<PropertyValue>> & /*lower*/,
     const std::optional<utils::Bound<PropertyValue>> & /*upper*/) const {
+  if (auto stats = GetIndexStats({label, property})) {
+    return stats->count;
+  }
   return 10;
 }
 
@@ -228,4 +250,39 @@ void DiskLabelPropertyIndex::LoadIndexInfo(const std::vector<std::string> &keys)
 
 RocksDBStorage *DiskLabelPropertyIndex::GetRocksDBStorage() const { return kvstore_.get(); }
 
+std::vector<std::pair<LabelId, PropertyId>> DiskLabelPropertyIndex::ClearIndexStats() {
+  std::vector<std::pair<LabelId, PropertyId>> deleted_indexes;
+  deleted_indexes.reserve(stats_.size());
+  std::transform(stats_.begin(), stats_.end(), std::back_inserter(deleted_indexes),
+                 [](const auto &elem) { return elem.first; });
+  stats_.clear();
+  return deleted_indexes;
+}
+
+std::vector<std::pair<LabelId, PropertyId>> DiskLabelPropertyIndex::DeleteIndexStats(const storage::LabelId &label) {
+  std::vector<std::pair<LabelId, PropertyId>> deleted_indexes;
+  for (auto it = stats_.cbegin(); it != stats_.cend();) {
+    if (it->first.first == label) {
+      deleted_indexes.push_back(it->first);
+      it = stats_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  return deleted_indexes;
+}
+
+void DiskLabelPropertyIndex::SetIndexStats(const std::pair<storage::LabelId, storage::PropertyId> &key,
+                                           const LabelPropertyIndexStats &stats) {
+  stats_[key] = stats;
+}
+
+std::optional<LabelPropertyIndexStats> DiskLabelPropertyIndex::GetIndexStats(
+    const std::pair<storage::LabelId, storage::PropertyId> &key) const {
+  if (auto it = stats_.find(key); it != stats_.end()) {
+    return it->second;
+  }
+  return {};
+}
+
 }  // namespace memgraph::storage
@@ -49,6 +49,8 @@ class DiskLabelPropertyIndex : public storage::LabelPropertyIndex {
 
   std::vector<std::pair<LabelId, PropertyId>> ListIndices() const override;
 
+  /// The estimates are taken from the index statistics, or are constant if
+  /// the label wasn't analyzed.
   uint64_t ApproximateVertexCount(LabelId label, PropertyId property) const override;
 
   uint64_t ApproximateVertexCount(LabelId label, PropertyId property, const PropertyValue &value) const override;
@@ -61,10 +63,21 @@ class DiskLabelPropertyIndex : public storage::LabelPropertyIndex {
 
   void LoadIndexInfo(const std::vector<std::string> &keys);
 
+  std::vector<std::pair<LabelId, PropertyId>> ClearIndexStats();
+
+  std::vector<std::pair<LabelId, PropertyId>> DeleteIndexStats(const storage::LabelId &label);
+
+  void SetIndexStats(const std::pair<storage::LabelId, storage::PropertyId> &key,
+                     const storage::LabelPropertyIndexStats &stats);
+
+  std::optional<storage::LabelPropertyIndexStats> GetIndexStats(
+      const std::pair<storage::LabelId, storage::PropertyId> &key) const;
+
  private:
   utils::Synchronized<std::map<uint64_t, std::map<Gid, std::vector<std::pair<LabelId, PropertyId>>>>>
       entries_for_deletion;
   std::set<std::pair<LabelId, PropertyId>> index_;
+  std::map<std::pair<LabelId, PropertyId>, storage::LabelPropertyIndexStats> stats_;
   std::unique_ptr<RocksDBStorage> kvstore_;
 };
 
@@ -10,9 +10,22 @@
 // licenses/APL.txt.
 
 #include "rocksdb_storage.hpp"
+#include <memory>
 #include <string_view>
+#include <rocksdb/cache.h>
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/perf_context.h>
+#include <rocksdb/table.h>
+#include "utils/event_counter.hpp"
+#include "utils/event_histogram.hpp"
 #include "utils/rocksdb_serialization.hpp"
 
+namespace memgraph::metrics {
+extern const Event DiskBlockCacheHits;
+extern const Event DiskBlockReads;
+extern const Event DiskBytesRead;
+}  // namespace memgraph::metrics
+
 namespace memgraph::storage {
 
 namespace {
@@ -36,8 +49,85 @@ std::string_view ExtractGidFromUserKey(const rocksdb::Slice &key) {
   return keyStrView.substr(keyStrView.find_last_of('|') + 1);
 }
 
+rocksdb::CompressionType ToRocksDBCompression(Config::DiskConfig::Compression compression) {
+  switch (compression) {
+    case Config::DiskConfig::Compression::NONE:
+      return rocksdb::kNoCompression;
+    case Config::DiskConfig::Compression::LZ4:
+      return rocksdb::kLZ4Compression;
+    case Config::DiskConfig::Compression::ZSTD:
+      return rocksdb::kZSTD;
+  }
+}
+
+// The block cache is a single process-wide cache shared by all of the RocksDB
+// instances of every on-disk database, so that a single setting bounds the
+// memory used for caching. Each configured database sets its capacity, so the
+// capacity is the one of the database configured last.
+std::shared_ptr<rocksdb::Cache> SharedBlockCache(uint64_t size_mib) {
+  static std::shared_ptr<rocksdb::Cache> cache = rocksdb::NewLRUCache(size_mib * 1024 * 1024);
+  cache->SetCapacity(size_mib * 1024 * 1024);
+  return cache;
+}
+
+// Number of RocksDBReadMetrics objects alive in the current thread. Only the
+// outermost one records the metrics so that the nested reads aren't counted
+// twice.
+thread_local uint64_t read_metrics_depth = 0;
+
 }  // namespace
 
+void ApplyDiskConfig(rocksdb::Options &options, const Config::DiskConfig &config) {
+  options.compression = ToRocksDBCompression(config.compression);
+  options.wal_compression =
+      config.compression == Config::DiskConfig::Compression::ZSTD ? rocksdb::kZSTD : rocksdb::kNoCompression;
+  options.use_direct_reads = config.use_direct_io;
+  options.use_direct_io_for_flush_and_compaction = config.use_direct_io;
+
+  rocksdb::BlockBasedTableOptions table_options;
+  if (config.block_cache_size_mib != 0) {
+    table_options.block_cache = SharedBlockCache(config.block_cache_size_mib);
+  }
+  if (config.bloom_filter_bits_per_key != 0) {
+    // The comparator orders the keys by the GID at their end, so keys with a
+    // common prefix aren't stored next to each other and prefix filters
+    // can't be used. Whole keys are filtered instead, which speeds up the
+    // point lookups done when transactions are validated.
+    table_options.filter_policy.reset(
+        rocksdb::NewBloomFilterPolicy(static_cast<double>(config.bloom_filter_bits_per_key)));
+    table_options.whole_key_filtering = true;
+  }
+  options.table_factory.reset(rocksdb::NewBlockBasedTableFactory(table_options));
+}
+
+RocksDBReadMetrics::RocksDBReadMetrics(std::optional<uint64_t> *bytes_read)
+    : bytes_read_(bytes_read), outermost_(read_metrics_depth++ == 0) {
+  if (!outermost_) return;
+  previous_perf_level_ = rocksdb::GetPerfLevel();
+  if (previous_perf_level_ < rocksdb::PerfLevel::kEnableCount) {
+    rocksdb::SetPerfLevel(rocksdb::PerfLevel::kEnableCount);
+  }
+  const auto *context = rocksdb::get_perf_context();
+  block_cache_hits_ = context->block_cache_hit_count;
+  block_reads_ = context->block_read_count;
+  block_read_bytes_ = context->block_read_byte;
+}
+
+RocksDBReadMetrics::~RocksDBReadMetrics() {
+  --read_metrics_depth;
+  if (!outermost_) return;
+  const auto *context = rocksdb::get_perf_context();
+  const auto block_read_bytes = context->block_read_byte - block_read_bytes_;
+  memgraph::metrics::IncrementCounter(memgraph::metrics::DiskBlockCacheHits,
+                                      context->block_cache_hit_count - block_cache_hits_);
+  memgraph::metrics::IncrementCounter(memgraph::metrics::DiskBlockReads, context->block_read_count - block_reads_);
+  memgraph::metrics::IncrementCounter(memgraph::metrics::DiskBytesRead, block_read_bytes);
+  if (bytes_read_ && *bytes_read_) **bytes_read_ += block_read_bytes;
+  if (previous_perf_level_ < rocksdb::PerfLevel::kEnableCount) {
+    rocksdb::SetPerfLevel(previous_perf_level_);
+  }
+}
+
 ComparatorWithU64TsImpl::ComparatorWithU64TsImpl()
     : Comparator(/*ts_sz=*/sizeof(uint64_t)), cmp_without_ts_(rocksdb::BytewiseComparator()) {
   assert(cmp_without_ts_->timestamp_size() == 0);
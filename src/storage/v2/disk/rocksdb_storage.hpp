@@ -11,13 +11,17 @@
 
 #pragma once
 
+#include <optional>
+
 #include <rocksdb/comparator.h>
 #include <rocksdb/db.h>
 #include <rocksdb/iterator.h>
 #include <rocksdb/options.h>
+#include <rocksdb/perf_level.h>
 #include <rocksdb/status.h>
 #include <rocksdb/utilities/transaction_db.h>
 
+#include "storage/v2/config.hpp"
 #include "storage/v2/edge_accessor.hpp"
 #include "storage/v2/edge_direction.hpp"
 #include "storage/v2/id_types.hpp"
@@ -64,6 +68,37 @@ struct RocksDBStorage {
   }
 };
 
+/// Applies the compression, block cache, bloom filter and direct I/O settings
+/// of the disk storage to the options of a RocksDB instance. The options are
+/// used for all of the instance's column families. A non-zero block cache size
+/// resizes the single block cache shared by the whole process.
+void ApplyDiskConfig(rocksdb::Options &options, const Config::DiskConfig &config);
+
+/// Adds the block cache hits, the block reads and the bytes read by RocksDB
+/// in the current thread while the object is alive to the disk storage
+/// metrics. Objects nested in the same thread are no-ops, so the reads are
+/// counted once, by the outermost object.
+class RocksDBReadMetrics {
+ public:
+  /// @param bytes_read optional counter of the bytes read by a transaction
+  explicit RocksDBReadMetrics(std::optional<uint64_t> *bytes_read = nullptr);
+
+  RocksDBReadMetrics(const RocksDBReadMetrics &) = delete;
+  RocksDBReadMetrics &operator=(const RocksDBReadMetrics &) = delete;
+  RocksDBReadMetrics(RocksDBReadMetrics &&) = delete;
+  RocksDBReadMetrics &operator=(RocksDBReadMetrics &&) = delete;
+
+  ~RocksDBReadMetrics();
+
+ private:
+  std::optional<uint64_t> *bytes_read_;
+  bool outermost_;
+  rocksdb::PerfLevel previous_perf_level_{rocksdb::PerfLevel::kUninitialized};
+  uint64_t block_cache_hits_{0};
+  uint64_t block_reads_{0};
+  uint64_t block_read_bytes_{0};
+};
+
 /// RocksDB comparator that compares keys with timestamps.
 class ComparatorWithU64TsImpl : public rocksdb::Comparator {
  public:
@@ -9,10 +9,12 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <cstring>
 #include <limits>
 #include <optional>
 #include <stdexcept>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include <rocksdb/comparator.h>
@@ -32,6 +34,7 @@
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/mvcc.hpp"
 #include "storage/v2/property_store.hpp"
+#include "storage/v2/property_string_dictionary.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/result.hpp"
 #include "storage/v2/storage.hpp"
@@ -53,6 +56,10 @@
 #include "utils/stat.hpp"
 #include "utils/string.hpp"
 
+namespace memgraph::metrics {
+extern const Event DiskBytesReadPerTransaction;
+}  // namespace memgraph::metrics
+
 namespace memgraph::storage {
 
 using OOMExceptionEnabler = utils::MemoryTracker::OutOfMemoryExceptionEnabler;
@@ -67,6 +74,8 @@ constexpr const char *label_index_str = "label_index";
 constexpr const char *label_property_index_str = "label_property_index";
 constexpr const char *existence_constraints_str = "existence_constraints";
 constexpr const char *unique_constraints_str = "unique_constraints";
+constexpr const char *label_index_stats_prefix = "label_index_stats_";
+constexpr const char *label_property_index_stats_prefix = "label_property_index_stats_";
 
 bool VertexNeedsToBeSerialized(const Vertex &vertex) {
   Delta *head = vertex.delta;
@@ -205,6 +214,7 @@ void DiskStorage::LoadIndexInfoIfExists() const {
   if (utils::DirExists(config_.disk.durability_directory)) {
     LoadLabelIndexInfoIfExists();
     LoadLabelPropertyIndexInfoIfExists();
+    LoadIndexStatsIfExists();
   }
 }
 
@@ -225,6 +235,33 @@ void DiskStorage::LoadLabelPropertyIndexInfoIfExists() const {
   }
 }
 
+void DiskStorage::LoadIndexStatsIfExists() const {
+  auto *disk_label_index = static_cast<DiskLabelIndex *>(indices_.label_index_.get());
+  for (auto it = durability_kvstore_->begin(label_index_stats_prefix);
+       it != durability_kvstore_->end(label_index_stats_prefix); ++it) {
+    const auto &[key, value] = *it;
+    const auto label = LabelId::FromUint(std::stoull(key.substr(std::strlen(label_index_stats_prefix))));
+    const std::vector<std::string> stats = utils::Split(value, "|");
+    MG_ASSERT(stats.size() == 2, "Invalid label index statistics: {}", value);
+    disk_label_index->SetIndexStats(label, LabelIndexStats{std::stoull(stats[0]), std::stod(stats[1])});
+  }
+
+  auto *disk_label_property_index = static_cast<DiskLabelPropertyIndex *>(indices_.label_property_index_.get());
+  for (auto it = durability_kvstore_->begin(label_property_index_stats_prefix);
+       it != durability_kvstore_->end(label_property_index_stats_prefix); ++it) {
+    const auto &[key, value] = *it;
+    const std::vector<std::string> index =
+        utils::Split(key.substr(std::strlen(label_property_index_stats_prefix)), ",");
+    MG_ASSERT(index.size() == 2, "Invalid label property index statistics key: {}", key);
+    const std::vector<std::string> stats = utils::Split(value, "|");
+    MG_ASSERT(stats.size() == 5, "Invalid label property index statistics: {}", value);
+    disk_label_property_index->SetIndexStats(
+        {LabelId::FromUint(std::stoull(index[0])), PropertyId::FromUint(std::stoull(index[1]))},
+        LabelPropertyIndexStats{std::stoull(stats[0]), std::stoull(stats[1]), std::stod(stats[2]),
+                                std::stod(stats[3]), std::stod(stats[4])});
+  }
+}
+
 void DiskStorage::LoadConstraintsInfoIfExists() const {
   if (utils::DirExists(config_.disk.durability_directory)) {
     LoadExistenceConstraintInfoIfExists();
@@ -257,10 +294,9 @@ DiskStorage::DiskStorage(Config config)
   LoadConstraintsInfoIfExists();
   kvstore_->options_.create_if_missing = true;
   kvstore_->options_.comparator = new ComparatorWithU64TsImpl();
-  kvstore_->options_.compression = rocksdb::kNoCompression;
   kvstore_->options_.wal_recovery_mode = rocksdb::WALRecoveryMode::kPointInTimeRecovery;
   kvstore_->options_.wal_dir = config_.disk.wal_directory;
-  kvstore_->options_.wal_compression = rocksdb::kNoCompression;
+  ApplyDiskConfig(kvstore_->options_, config_.disk);
   std::vector<rocksdb::ColumnFamilyHandle *> column_handles;
   std::vector<rocksdb::ColumnFamilyDescriptor> column_families;
   if (utils::DirExists(config.disk.main_storage_directory)) {
@@ -306,7 +342,7 @@ DiskStorage::DiskAccessor::DiskAccessor(DiskStorage *storage, IsolationLevel iso
 }
 
 DiskStorage::DiskAccessor::DiskAccessor(DiskAccessor &&other) noexcept
-    : Accessor(std::move(other)), config_(other.config_) {
+    : Accessor(std::move(other)), config_(other.config_), bytes_read_(std::exchange(other.bytes_read_, std::nullopt)) {
   other.is_transaction_active_ = false;
   other.commit_timestamp_.reset();
 }
@@ -317,6 +353,10 @@ DiskStorage::DiskAccessor::~DiskAccessor() {
   }
 
   FinalizeTransaction();
+
+  if (bytes_read_) {
+    memgraph::metrics::Measure(memgraph::metrics::DiskBytesReadPerTransaction, *bytes_read_);
+  }
 }
 
 /// NOTE: This will create Delta object which will cause deletion of old key entry on the disk
@@ -401,6 +441,7 @@ VerticesIterable DiskStorage::DiskAccessor::Vertices(View view) {
                                                 &storage_->constraints_, storage_->config_.items));
   }
   auto *disk_storage = static_cast<DiskStorage *>(storage_);
+  RocksDBReadMetrics read_metrics(&bytes_read_);
   rocksdb::ReadOptions ro;
   std::string strTs = utils::StringTimestamp(transaction_.start_timestamp);
   rocksdb::Slice ts(strTs);
@@ -457,6 +498,7 @@ void DiskStorage::DiskAccessor::LoadVerticesFromDiskLabelIndex(LabelId label,
   auto disk_index_transaction = disk_label_index->CreateRocksDBTransaction();
   disk_index_transaction->SetReadTimestampForValidation(transaction_.start_timestamp);
 
+  RocksDBReadMetrics read_metrics(&bytes_read_);
   rocksdb::ReadOptions ro;
   std::string strTs = utils::StringTimestamp(transaction_.start_timestamp);
   rocksdb::Slice ts(strTs);
@@ -535,6 +577,7 @@ void DiskStorage::DiskAccessor::LoadVerticesFromDiskLabelPropertyIndex(LabelId l
 
   auto disk_index_transaction = disk_label_property_index->CreateRocksDBTransaction();
   disk_index_transaction->SetReadTimestampForValidation(transaction_.start_timestamp);
+  RocksDBReadMetrics read_metrics(&bytes_read_);
   rocksdb::ReadOptions ro;
   std::string strTs = utils::StringTimestamp(transaction_.start_timestamp);
   rocksdb::Slice ts(strTs);
@@ -584,6 +627,7 @@ void DiskStorage::DiskAccessor::LoadVerticesFromDiskLabelPropertyIndexWithPointV
       static_cast<DiskLabelPropertyIndex *>(storage_->indices_.label_property_index_.get());
   auto disk_index_transaction = disk_label_property_index->CreateRocksDBTransaction();
   disk_index_transaction->SetReadTimestampForValidation(transaction_.start_timestamp);
+  RocksDBReadMetrics read_metrics(&bytes_read_);
   rocksdb::ReadOptions ro;
   std::string strTs = utils::StringTimestamp(transaction_.start_timestamp);
   rocksdb::Slice ts(strTs);
@@ -659,6 +703,7 @@ void DiskStorage::DiskAccessor::LoadVerticesFromDiskLabelPropertyIndexForInterva
 
   auto disk_index_transaction = disk_label_property_index->CreateRocksDBTransaction();
   disk_index_transaction->SetReadTimestampForValidation(transaction_.start_timestamp);
+  RocksDBReadMetrics read_metrics(&bytes_read_);
   rocksdb::ReadOptions ro;
   std::string strTs = utils::StringTimestamp(transaction_.start_timestamp);
   rocksdb::Slice ts(strTs);
@@ -689,6 +734,123 @@ uint64_t DiskStorage::DiskAccessor::ApproximateVertexCount() const {
   return disk_storage->kvstore_->ApproximateVertexCount();
 }
 
+uint64_t DiskStorage::DiskAccessor::ApproximateVertexCount(LabelId label) const {
+  return storage_->indices_.label_index_->ApproximateVertexCount(label);
+}
+
+uint64_t DiskStorage::DiskAccessor::ApproximateVertexCount(LabelId label, PropertyId property) const {
+  return storage_->indices_.label_property_index_->ApproximateVertexCount(label, property);
+}
+
+uint64_t DiskStorage::DiskAccessor::ApproximateVertexCount(LabelId label, PropertyId property,
+                                                           const PropertyValue &value) const {
+  return storage_->indices_.label_property_index_->ApproximateVertexCount(label, property, value);
+}
+
+uint64_t DiskStorage::DiskAccessor::ApproximateVertexCount(
+    LabelId label, PropertyId property, const std::optional<utils::Bound<PropertyValue>> &lower,
+    const std::optional<utils::Bound<PropertyValue>> &upper) const {
+  return storage_->indices_.label_property_index_->ApproximateVertexCount(label, property, lower, upper);
+}
+
+std::optional<storage::LabelIndexStats> DiskStorage::DiskAccessor::GetIndexStats(const storage::LabelId &label) const {
+  return static_cast<DiskLabelIndex *>(storage_->indices_.label_index_.get())->GetIndexStats(label);
+}
+
+std::optional<storage::LabelPropertyIndexStats> DiskStorage::DiskAccessor::GetIndexStats(
+    const storage::LabelId &label, const storage::PropertyId &property) const {
+  return static_cast<DiskLabelPropertyIndex *>(storage_->indices_.label_property_index_.get())
+      ->GetIndexStats(std::make_pair(label, property));
+}
+
+void DiskStorage::DiskAccessor::SetIndexStats(const storage::LabelId &label, const LabelIndexStats &stats) {
+  auto *disk_storage = static_cast<DiskStorage *>(storage_);
+  static_cast<DiskLabelIndex *>(storage_->indices_.label_index_.get())->SetIndexStats(label, stats);
+  if (!disk_storage->PersistLabelIndexStats(label, stats)) {
+    spdlog::warn("Failed to persist the statistics of the label index on :{}.", storage_->LabelToName(label));
+  }
+}
+
+void DiskStorage::DiskAccessor::SetIndexStats(const storage::LabelId &label, const storage::PropertyId &property,
+                                              const LabelPropertyIndexStats &stats) {
+  auto *disk_storage = static_cast<DiskStorage *>(storage_);
+  static_cast<DiskLabelPropertyIndex *>(storage_->indices_.label_property_index_.get())
+      ->SetIndexStats(std::make_pair(label, property), stats);
+  if (!disk_storage->PersistLabelPropertyIndexStats(label, property, stats)) {
+    spdlog::warn("Failed to persist the statistics of the label property index on :{}({}).",
+                 storage_->LabelToName(label), storage_->PropertyToName(property));
+  }
+}
+
+std::vector<LabelId> DiskStorage::DiskAccessor::ClearLabelIndexStats() {
+  auto *disk_storage = static_cast<DiskStorage *>(storage_);
+  auto deleted_indexes = static_cast<DiskLabelIndex *>(storage_->indices_.label_index_.get())->ClearIndexStats();
+  for (const auto &label : deleted_indexes) {
+    disk_storage->PersistLabelIndexStatsDeletion(label);
+  }
+  return deleted_indexes;
+}
+
+std::vector<std::pair<LabelId, PropertyId>> DiskStorage::DiskAccessor::ClearLabelPropertyIndexStats() {
+  auto *disk_storage = static_cast<DiskStorage *>(storage_);
+  auto deleted_indexes =
+      static_cast<DiskLabelPropertyIndex *>(storage_->indices_.label_property_index_.get())->ClearIndexStats();
+  for (const auto &[label, property] : deleted_indexes) {
+    disk_storage->PersistLabelPropertyIndexStatsDeletion(label, property);
+  }
+  return deleted_indexes;
+}
+
+std::vector<LabelId> DiskStorage::DiskAccessor::DeleteLabelIndexStats(std::span<std::string> labels) {
+  auto *disk_storage = static_cast<DiskStorage *>(storage_);
+  auto *disk_label_index = static_cast<DiskLabelIndex *>(storage_->indices_.label_index_.get());
+  std::vector<LabelId> deleted_indexes;
+  for (const auto &label : labels) {
+    for (const auto &deleted_label : disk_label_index->DeleteIndexStats(NameToLabel(label))) {
+      disk_storage->PersistLabelIndexStatsDeletion(deleted_label);
+      deleted_indexes.push_back(deleted_label);
+    }
+  }
+  return deleted_indexes;
+}
+
+std::vector<std::pair<LabelId, PropertyId>> DiskStorage::DiskAccessor::DeleteLabelPropertyIndexStats(
+    const std::span<std::string> labels) {
+  auto *disk_storage = static_cast<DiskStorage *>(storage_);
+  auto *disk_label_property_index =
+      static_cast<DiskLabelPropertyIndex *>(storage_->indices_.label_property_index_.get());
+  std::vector<std::pair<LabelId, PropertyId>> deleted_indexes;
+  for (const auto &label : labels) {
+    for (const auto &[deleted_label, property] : disk_label_property_index->DeleteIndexStats(NameToLabel(label))) {
+      disk_storage->PersistLabelPropertyIndexStatsDeletion(deleted_label, property);
+      deleted_indexes.emplace_back(deleted_label, property);
+    }
+  }
+  return deleted_indexes;
+}
+
+bool DiskStorage::PersistLabelIndexStats(LabelId label, const LabelIndexStats &stats) const {
+  return durability_kvstore_->Put(label_index_stats_prefix + utils::SerializeIdType(label),
+                                  fmt::format("{}|{}", stats.count, stats.avg_degree));
+}
+
+bool DiskStorage::PersistLabelIndexStatsDeletion(LabelId label) const {
+  return durability_kvstore_->Delete(label_index_stats_prefix + utils::SerializeIdType(label));
+}
+
+bool DiskStorage::PersistLabelPropertyIndexStats(LabelId label, PropertyId property,
+                                                 const LabelPropertyIndexStats &stats) const {
+  return durability_kvstore_->Put(
+      label_property_index_stats_prefix + utils::SerializeIdType(label) + "," + utils::SerializeIdType(property),
+      fmt::format("{}|{}|{}|{}|{}", stats.count, stats.distinct_values_count, stats.statistic, stats.avg_group_size,
+                  stats.avg_degree));
+}
+
+bool DiskStorage::PersistLabelPropertyIndexStatsDeletion(LabelId label, PropertyId property) const {
+  return durability_kvstore_->Delete(label_property_index_stats_prefix + utils::SerializeIdType(label) + "," +
+                                     utils::SerializeIdType(property));
+}
+
 bool DiskStorage::PersistLabelIndexCreation(LabelId label) const {
   if (auto label_index_store = durability_kvstore_->Get(label_index_str); label_index_store.has_value()) {
     std::string &value = label_index_store.value();
@@ -792,6 +954,10 @@ StorageInfo DiskStorage::GetInfo() const {
   return {vertex_count, edge_count, average_degree, utils::GetMemoryUsage(), GetDiskSpaceUsage()};
 }
 
+void DiskStorage::FreeMemory(std::unique_lock<utils::RWLock> /*lock*/) {
+  PropertyStringDictionary::Global().CollectGarbage();
+}
+
 VertexAccessor DiskStorage::DiskAccessor::CreateVertex() {
   auto gid = storage_->vertex_id_.fetch_add(1, std::memory_order_acq_rel);
   auto acc = vertices_.access();
@@ -840,6 +1006,7 @@ std::optional<VertexAccessor> DiskStorage::DiskAccessor::FindVertex(storage::Gid
     }
   }
 
+  RocksDBReadMetrics read_metrics(&bytes_read_);
   rocksdb::ReadOptions read_opts;
   auto strTs = utils::StringTimestamp(transaction_.start_timestamp);
   rocksdb::Slice ts(strTs);
@@ -889,8 +1056,8 @@ DiskStorage::DiskAccessor::DetachDeleteVertex(VertexAccessor *vertex) {
             "accessor when deleting a vertex!");
   auto *vertex_ptr = vertex->vertex_;
 
-  std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> in_edges;
-  std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> out_edges;
+  std::vector<VertexEdges::value_type> in_edges;
+  std::vector<VertexEdges::value_type> out_edges;
 
   {
     std::lock_guard<utils::SpinLock> guard(vertex_ptr->lock);
@@ -899,8 +1066,8 @@ DiskStorage::DiskAccessor::DetachDeleteVertex(VertexAccessor *vertex) {
 
     if (vertex_ptr->deleted) return std::optional<ReturnType>{};
 
-    in_edges = vertex_ptr->in_edges;
-    out_edges = vertex_ptr->out_edges;
+    in_edges.assign(vertex_ptr->in_edges.begin(), vertex_ptr->in_edges.end());
+    out_edges.assign(vertex_ptr->out_edges.begin(), vertex_ptr->out_edges.end());
   }
 
   std::vector<EdgeAccessor> deleted_edges;
@@ -980,6 +1147,7 @@ bool DiskStorage::DiskAccessor::PrefetchEdgeFilter(const std::string_view disk_e
 }
 
 void DiskStorage::DiskAccessor::PrefetchEdges(const VertexAccessor &vertex_acc, EdgeDirection edge_direction) {
+  RocksDBReadMetrics read_metrics(&bytes_read_);
   rocksdb::ReadOptions read_opts;
   auto strTs = utils::StringTimestamp(transaction_.start_timestamp);
   rocksdb::Slice ts(strTs);
@@ -1059,8 +1227,8 @@ Result<EdgeAccessor> DiskStorage::DiskAccessor::CreateEdge(const VertexAccessor
     edge.ptr->properties.SetBuffer(properties);
   }
 
-  from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
-  to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+  from_vertex->out_edges.Add(edge_type, to_vertex, edge);
+  to_vertex->in_edges.Add(edge_type, from_vertex, edge);
 
   transaction_.manyDeltasCache.Invalidate(from_vertex, edge_type, EdgeDirection::OUT);
   transaction_.manyDeltasCache.Invalidate(to_vertex, edge_type, EdgeDirection::IN);
@@ -1119,10 +1287,10 @@ Result<EdgeAccessor> DiskStorage::DiskAccessor::CreateEdge(VertexAccessor *from,
   }
 
   CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge);
-  from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
+  from_vertex->out_edges.Add(edge_type, to_vertex, edge);
 
   CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge);
-  to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+  to_vertex->in_edges.Add(edge_type, from_vertex, edge);
 
   transaction_.manyDeltasCache.Invalidate(from_vertex, edge_type, EdgeDirection::OUT);
   transaction_.manyDeltasCache.Invalidate(to_vertex, edge_type, EdgeDirection::IN);
@@ -1177,16 +1345,11 @@ Result<std::optional<EdgeAccessor>> DiskStorage::DiskAccessor::DeleteEdge(EdgeAc
   }
 
   auto delete_edge_from_storage = [&edge_type, &edge_ref, this](auto *vertex, auto *edges) {
-    const std::tuple<EdgeTypeId, Vertex *, EdgeRef> link(edge_type, vertex, edge_ref);
-    auto it = std::find(edges->begin(), edges->end(), link);
+    const bool removed = edges->Remove(edge_type, vertex, edge_ref);
     if (config_.properties_on_edges) {
-      MG_ASSERT(it != edges->end(), "Invalid database state!");
-    } else if (it == edges->end()) {
-      return false;
+      MG_ASSERT(removed, "Invalid database state!");
     }
-    std::swap(*it, *edges->rbegin());
-    edges->pop_back();
-    return true;
+    return removed;
   };
 
   const auto op1 = delete_edge_from_storage(to_vertex, &from_vertex->out_edges);
@@ -1359,7 +1522,7 @@ DiskStorage::DiskAccessor::CheckVertexConstraintsBeforeCommit(
       }
     }
 
-    for (auto &edge_entry : vertex.out_edges) {
+    for (const auto &edge_entry : vertex.out_edges) {
       EdgeRef edge = std::get<2>(edge_entry);
       const DiskEdgeKey src_dest_key(vertex.gid, std::get<1>(edge_entry)->gid, std::get<0>(edge_entry), edge,
                                      config_.properties_on_edges);
@@ -1440,7 +1603,7 @@ DiskStorage::DiskAccessor::CheckVertexConstraintsBeforeCommit(
         return StorageDataManipulationError{SerializationError{}};
       }
 
-      for (auto &edge_entry : vertex.out_edges) {
+      for (const auto &edge_entry : vertex.out_edges) {
         EdgeRef edge = std::get<2>(edge_entry);
         DiskEdgeKey src_dest_key(vertex.gid, std::get<1>(edge_entry)->gid, std::get<0>(edge_entry), edge,
                                  config_.properties_on_edges);
@@ -1459,6 +1622,7 @@ DiskStorage::DiskAccessor::CheckVertexConstraintsBeforeCommit(
 
 [[nodiscard]] std::optional<ConstraintViolation> DiskStorage::CheckExistingVerticesBeforeCreatingExistenceConstraint(
     LabelId label, PropertyId property) const {
+  RocksDBReadMetrics read_metrics;
   rocksdb::ReadOptions ro;
   std::string strTs = utils::StringTimestamp(std::numeric_limits<uint64_t>::max());
   rocksdb::Slice ts(strTs);
@@ -1480,6 +1644,7 @@ DiskStorage::CheckExistingVerticesBeforeCreatingUniqueConstraint(LabelId label,
   std::set<std::vector<PropertyValue>> unique_storage;
   std::vector<std::pair<std::string, std::string>> vertices_for_constraints;
 
+  RocksDBReadMetrics read_metrics;
   rocksdb::ReadOptions ro;
   std::string strTs = utils::StringTimestamp(std::numeric_limits<uint64_t>::max());
   rocksdb::Slice ts(strTs);
@@ -1551,6 +1716,7 @@ utils::BasicResult<StorageDataManipulationError, void> DiskStorage::DiskAccessor
 std::vector<std::pair<std::string, std::string>> DiskStorage::SerializeVerticesForLabelIndex(LabelId label) {
   std::vector<std::pair<std::string, std::string>> vertices_to_be_indexed;
 
+  RocksDBReadMetrics read_metrics;
   rocksdb::ReadOptions ro;
   auto strTs = utils::StringTimestamp(std::numeric_limits<uint64_t>::max());
   rocksdb::Slice ts(strTs);
@@ -1577,6 +1743,7 @@ std::vector<std::pair<std::string, std::string>> DiskStorage::SerializeVerticesF
     LabelId label, PropertyId property) {
   std::vector<std::pair<std::string, std::string>> vertices_to_be_indexed;
 
+  RocksDBReadMetrics read_metrics;
   rocksdb::ReadOptions ro;
   auto strTs = utils::StringTimestamp(std::numeric_limits<uint64_t>::max());
   rocksdb::Slice ts(strTs);
@@ -1668,7 +1835,7 @@ utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::DropIndex(
     return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
 
-  if (!PersistLabelIndexDeletion(label)) {
+  if (!PersistLabelIndexDeletion(label) || !PersistLabelIndexStatsDeletion(label)) {
     return StorageIndexDefinitionError{IndexPersistenceError{}};
   }
 
@@ -1686,7 +1853,8 @@ utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::DropIndex(
     return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
 
-  if (!PersistLabelPropertyIndexAndExistenceConstraintDeletion(label, property, label_property_index_str)) {
+  if (!PersistLabelPropertyIndexAndExistenceConstraintDeletion(label, property, label_property_index_str) ||
+      !PersistLabelPropertyIndexStatsDeletion(label, property)) {
     return StorageIndexDefinitionError{IndexPersistenceError{}};
   }
 
@@ -104,55 +104,34 @@ class DiskStorage final : public Storage {
 
     uint64_t ApproximateVertexCount() const override;
 
-    uint64_t ApproximateVertexCount(LabelId /*label*/) const override { return 10; }
+    uint64_t ApproximateVertexCount(LabelId label) const override;
 
-    uint64_t ApproximateVertexCount(LabelId /*label*/, PropertyId /*property*/) const override { return 10; }
+    uint64_t ApproximateVertexCount(LabelId label, PropertyId property) const override;
 
-    uint64_t ApproximateVertexCount(LabelId /*label*/, PropertyId /*property*/,
-                                    const PropertyValue & /*value*/) const override {
-      return 10;
-    }
+    uint64_t ApproximateVertexCount(LabelId label, PropertyId property, const PropertyValue &value) const override;
 
-    uint64_t ApproximateVertexCount(LabelId /*label*/, PropertyId /*property*/,
-                                    const std::optional<utils::Bound<PropertyValue>> & /*lower*/,
-                                    const std::optional<utils::Bound<PropertyValue>> & /*upper*/) const override {
-      return 10;
-    }
+    uint64_t ApproximateVertexCount(LabelId label, PropertyId property,
+                                    const std::optional<utils::Bound<PropertyValue>> &lower,
+                                    const std::optional<utils::Bound<PropertyValue>> &upper) const override;
 
-    std::optional<storage::LabelIndexStats> GetIndexStats(const storage::LabelId & /*label*/) const override {
-      return {};
-    }
+    std::optional<storage::LabelIndexStats> GetIndexStats(const storage::LabelId &label) const override;
 
-    std::optional<storage::LabelPropertyIndexStats> GetIndexStats(
-        const storage::LabelId & /*label*/, const storage::PropertyId & /*property*/) const override {
-      return {};
-    }
+    std::optional<storage::LabelPropertyIndexStats> GetIndexStats(const storage::LabelId &label,
+                                                                  const storage::PropertyId &property) const override;
 
-    std::vector<LabelId> ClearLabelIndexStats() override {
-      throw utils::NotYetImplemented("ClearIndexStats() is not implemented for DiskStorage.");
-    }
+    std::vector<LabelId> ClearLabelIndexStats() override;
 
-    std::vector<std::pair<LabelId, PropertyId>> ClearLabelPropertyIndexStats() override {
-      throw utils::NotYetImplemented("ClearIndexStats() is not implemented for DiskStorage.");
-    }
+    std::vector<std::pair<LabelId, PropertyId>> ClearLabelPropertyIndexStats() override;
 
-    std::vector<LabelId> DeleteLabelIndexStats(std::span<std::string> /*labels*/) override {
-      throw utils::NotYetImplemented("DeleteIndexStatsForLabels(labels) is not implemented for DiskStorage.");
-    }
+    std::vector<LabelId> DeleteLabelIndexStats(std::span<std::string> labels) override;
 
     std::vector<std::pair<LabelId, PropertyId>> DeleteLabelPropertyIndexStats(
-        const std::span<std::string> /*labels*/) override {
-      throw utils::NotYetImplemented("DeleteIndexStatsForLabels(labels) is not implemented for DiskStorage.");
-    }
+        const std::span<std::string> labels) override;
 
-    void SetIndexStats(const storage::LabelId & /*label*/, const LabelIndexStats & /*stats*/) override {
-      throw utils::NotYetImplemented("SetIndexStats(stats) is not implemented for DiskStorage.");
-    }
+    void SetIndexStats(const storage::LabelId &label, const LabelIndexStats &stats) override;
 
-    void SetIndexStats(const storage::LabelId & /*label*/, const storage::PropertyId & /*property*/,
-                       const LabelPropertyIndexStats & /*stats*/) override {
-      throw utils::NotYetImplemented("SetIndexStats(stats) is not implemented for DiskStorage.");
-    }
+    void SetIndexStats(const storage::LabelId &label, const storage::PropertyId &property,
+                       const LabelPropertyIndexStats &stats) override;
 
     /// TODO: It is just marked as deleted but the memory isn't reclaimed because of the in-memory storage
     Result<std::optional<VertexAccessor>> DeleteVertex(VertexAccessor *vertex) override;
@@ -247,6 +226,9 @@ class DiskStorage final : public Storage {
     std::vector<std::pair<std::string, std::string>> vertices_to_delete_;
     rocksdb::Transaction *disk_transaction_;
     bool scanned_all_vertices_ = false;
+    // Bytes read from the disk by the transaction. Empty if the accessor was
+    // moved.
+    std::optional<uint64_t> bytes_read_{0};
   };
 
   std::unique_ptr<Storage::Accessor> Access(std::optional<IsolationLevel> override_isolation_level) override {
@@ -313,6 +295,18 @@ class DiskStorage final : public Storage {
 
   void LoadUniqueConstraintInfoIfExists() const;
 
+  /// Index statistics are persisted one key per index, so that ANALYZE GRAPH
+  /// doesn't have to rewrite the statistics of all indices.
+  bool PersistLabelIndexStats(LabelId label, const LabelIndexStats &stats) const;
+
+  bool PersistLabelIndexStatsDeletion(LabelId label) const;
+
+  bool PersistLabelPropertyIndexStats(LabelId label, PropertyId property, const LabelPropertyIndexStats &stats) const;
+
+  bool PersistLabelPropertyIndexStatsDeletion(LabelId label, PropertyId property) const;
+
+  void LoadIndexStatsIfExists() const;
+
   uint64_t GetDiskSpaceUsage() const;
 
   void LoadTimestampIfExists();
@@ -330,7 +324,10 @@ class DiskStorage final : public Storage {
 
   StorageInfo GetInfo() const override;
 
-  void FreeMemory(std::unique_lock<utils::RWLock> /*lock*/) override {}
+  /// The disk storage has no periodic garbage collector, so the interned
+  /// strings released by its transactions are collected only here, i.e. on
+  /// FREE MEMORY.
+  void FreeMemory(std::unique_lock<utils::RWLock> /*lock*/) override;
 
   uint64_t CommitTimestamp(std::optional<uint64_t> desired_commit_timestamp = {});
 
@@ -61,6 +61,7 @@ DiskUniqueConstraints::DiskUniqueConstraints(const Config &config) {
   utils::EnsureDirOrDie(config.disk.unique_constraints_directory);
   kvstore_->options_.create_if_missing = true;
   kvstore_->options_.comparator = new ComparatorWithU64TsImpl();
+  ApplyDiskConfig(kvstore_->options_, config.disk);
   logging::AssertRocksDBStatus(rocksdb::TransactionDB::Open(kvstore_->options_, rocksdb::TransactionDBOptions(),
                                                             config.disk.unique_constraints_directory, &kvstore_->db_));
 }
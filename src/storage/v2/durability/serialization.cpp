@@ -21,115 +21,134 @@ namespace memgraph::storage::durability {
 //////////////////////////
 
 namespace {
-void WriteSize(Encoder *encoder, uint64_t size) {
+template <typename TEncoder>
+void WriteSize(TEncoder *encoder, uint64_t size) {
   size = utils::HostToLittleEndian(size);
   encoder->Write(reinterpret_cast<const uint8_t *>(&size), sizeof(size));
 }
-}  // namespace
-
-void Encoder::Initialize(const std::filesystem::path &path, const std::string_view magic, uint64_t version) {
-  file_.Open(path, utils::OutputFile::Mode::OVERWRITE_EXISTING);
-  Write(reinterpret_cast<const uint8_t *>(magic.data()), magic.size());
-  auto version_encoded = utils::HostToLittleEndian(version);
-  Write(reinterpret_cast<const uint8_t *>(&version_encoded), sizeof(version_encoded));
-}
-
-void Encoder::OpenExisting(const std::filesystem::path &path) {
-  file_.Open(path, utils::OutputFile::Mode::APPEND_TO_EXISTING);
-}
-
-void Encoder::Close() {
-  if (file_.IsOpen()) {
-    file_.Close();
-  }
-}
 
-void Encoder::Write(const uint8_t *data, uint64_t size) { file_.Write(data, size); }
-
-void Encoder::WriteMarker(Marker marker) {
+template <typename TEncoder>
+void WriteMarkerImpl(TEncoder *encoder, Marker marker) {
   auto value = static_cast<uint8_t>(marker);
-  Write(&value, sizeof(value));
+  encoder->Write(&value, sizeof(value));
 }
 
-void Encoder::WriteBool(bool value) {
-  WriteMarker(Marker::TYPE_BOOL);
+template <typename TEncoder>
+void WriteBoolImpl(TEncoder *encoder, bool value) {
+  encoder->WriteMarker(Marker::TYPE_BOOL);
   if (value) {
-    WriteMarker(Marker::VALUE_TRUE);
+    encoder->WriteMarker(Marker::VALUE_TRUE);
   } else {
-    WriteMarker(Marker::VALUE_FALSE);
+    encoder->WriteMarker(Marker::VALUE_FALSE);
   }
 }
 
-void Encoder::WriteUint(uint64_t value) {
+template <typename TEncoder>
+void WriteUintImpl(TEncoder *encoder, uint64_t value) {
   value = utils::HostToLittleEndian(value);
-  WriteMarker(Marker::TYPE_INT);
-  Write(reinterpret_cast<const uint8_t *>(&value), sizeof(value));
+  encoder->WriteMarker(Marker::TYPE_INT);
+  encoder->Write(reinterpret_cast<const uint8_t *>(&value), sizeof(value));
 }
 
-void Encoder::WriteDouble(double value) {
+template <typename TEncoder>
+void WriteDoubleImpl(TEncoder *encoder, double value) {
   auto value_uint = utils::MemcpyCast<uint64_t>(value);
   value_uint = utils::HostToLittleEndian(value_uint);
-  WriteMarker(Marker::TYPE_DOUBLE);
-  Write(reinterpret_cast<const uint8_t *>(&value_uint), sizeof(value_uint));
+  encoder->WriteMarker(Marker::TYPE_DOUBLE);
+  encoder->Write(reinterpret_cast<const uint8_t *>(&value_uint), sizeof(value_uint));
 }
 
-void Encoder::WriteString(const std::string_view value) {
-  WriteMarker(Marker::TYPE_STRING);
-  WriteSize(this, value.size());
-  Write(reinterpret_cast<const uint8_t *>(value.data()), value.size());
+template <typename TEncoder>
+void WriteStringImpl(TEncoder *encoder, const std::string_view value) {
+  encoder->WriteMarker(Marker::TYPE_STRING);
+  WriteSize(encoder, value.size());
+  encoder->Write(reinterpret_cast<const uint8_t *>(value.data()), value.size());
 }
 
-void Encoder::WritePropertyValue(const PropertyValue &value) {
-  WriteMarker(Marker::TYPE_PROPERTY_VALUE);
+template <typename TEncoder>
+void WritePropertyValueImpl(TEncoder *encoder, const PropertyValue &value) {
+  encoder->WriteMarker(Marker::TYPE_PROPERTY_VALUE);
   switch (value.type()) {
     case PropertyValue::Type::Null: {
-      WriteMarker(Marker::TYPE_NULL);
+      encoder->WriteMarker(Marker::TYPE_NULL);
       break;
     }
     case PropertyValue::Type::Bool: {
-      WriteBool(value.ValueBool());
+      encoder->WriteBool(value.ValueBool());
       break;
     }
     case PropertyValue::Type::Int: {
-      WriteUint(utils::MemcpyCast<uint64_t>(value.ValueInt()));
+      encoder->WriteUint(utils::MemcpyCast<uint64_t>(value.ValueInt()));
       break;
     }
     case PropertyValue::Type::Double: {
-      WriteDouble(value.ValueDouble());
+      encoder->WriteDouble(value.ValueDouble());
       break;
     }
     case PropertyValue::Type::String: {
-      WriteString(value.ValueString());
+      encoder->WriteString(value.ValueString());
       break;
     }
     case PropertyValue::Type::List: {
       const auto &list = value.ValueList();
-      WriteMarker(Marker::TYPE_LIST);
-      WriteSize(this, list.size());
+      encoder->WriteMarker(Marker::TYPE_LIST);
+      WriteSize(encoder, list.size());
       for (const auto &item : list) {
-        WritePropertyValue(item);
+        encoder->WritePropertyValue(item);
       }
       break;
     }
     case PropertyValue::Type::Map: {
       const auto &map = value.ValueMap();
-      WriteMarker(Marker::TYPE_MAP);
-      WriteSize(this, map.size());
+      encoder->WriteMarker(Marker::TYPE_MAP);
+      WriteSize(encoder, map.size());
       for (const auto &item : map) {
-        WriteString(item.first);
-        WritePropertyValue(item.second);
+        encoder->WriteString(item.first);
+        encoder->WritePropertyValue(item.second);
       }
       break;
     }
     case PropertyValue::Type::TemporalData: {
       const auto temporal_data = value.ValueTemporalData();
-      WriteMarker(Marker::TYPE_TEMPORAL_DATA);
-      WriteUint(static_cast<uint64_t>(temporal_data.type));
-      WriteUint(utils::MemcpyCast<uint64_t>(temporal_data.microseconds));
+      encoder->WriteMarker(Marker::TYPE_TEMPORAL_DATA);
+      encoder->WriteUint(static_cast<uint64_t>(temporal_data.type));
+      encoder->WriteUint(utils::MemcpyCast<uint64_t>(temporal_data.microseconds));
       break;
     }
   }
 }
+}  // namespace
+
+void Encoder::Initialize(const std::filesystem::path &path, const std::string_view magic, uint64_t version) {
+  file_.Open(path, utils::OutputFile::Mode::OVERWRITE_EXISTING);
+  Write(reinterpret_cast<const uint8_t *>(magic.data()), magic.size());
+  auto version_encoded = utils::HostToLittleEndian(version);
+  Write(reinterpret_cast<const uint8_t *>(&version_encoded), sizeof(version_encoded));
+}
+
+void Encoder::OpenExisting(const std::filesystem::path &path) {
+  file_.Open(path, utils::OutputFile::Mode::APPEND_TO_EXISTING);
+}
+
+void Encoder::Close() {
+  if (file_.IsOpen()) {
+    file_.Close();
+  }
+}
+
+void Encoder::Write(const uint8_t *data, uint64_t size) { file_.Write(data, size); }
+
+void Encoder::WriteMarker(Marker marker) { WriteMarkerImpl(this, marker); }
+
+void Encoder::WriteBool(bool value) { WriteBoolImpl(this, value); }
+
+void Encoder::WriteUint(uint64_t value) { WriteUintImpl(this, value); }
+
+void Encoder::WriteDouble(double value) { WriteDoubleImpl(this, value); }
+
+void Encoder::WriteString(const std::string_view value) { WriteStringImpl(this, value); }
+
+void Encoder::WritePropertyValue(const PropertyValue &value) { WritePropertyValueImpl(this, value); }
 
 uint64_t Encoder::GetPosition() { return file_.GetPosition(); }
 
@@ -137,6 +156,8 @@ void Encoder::SetPosition(uint64_t position) { file_.SetPosition(utils::OutputFi
 
 void Encoder::Sync() { file_.Sync(); }
 
+utils::FileSyncHandle Encoder::SyncHandle() { return file_.SyncHandle(); }
+
 void Encoder::Finalize() {
   file_.Sync();
   file_.Close();
@@ -152,6 +173,24 @@ std::pair<const uint8_t *, size_t> Encoder::CurrentFileBuffer() const { return f
 
 size_t Encoder::GetSize() { return file_.GetSize(); }
 
+////////////////////////////////
+// BufferEncoder implementation.
+////////////////////////////////
+
+void BufferEncoder::Write(const uint8_t *data, uint64_t size) { buffer_.insert(buffer_.end(), data, data + size); }
+
+void BufferEncoder::WriteMarker(Marker marker) { WriteMarkerImpl(this, marker); }
+
+void BufferEncoder::WriteBool(bool value) { WriteBoolImpl(this, value); }
+
+void BufferEncoder::WriteUint(uint64_t value) { WriteUintImpl(this, value); }
+
+void BufferEncoder::WriteDouble(double value) { WriteDoubleImpl(this, value); }
+
+void BufferEncoder::WriteString(const std::string_view value) { WriteStringImpl(this, value); }
+
+void BufferEncoder::WritePropertyValue(const PropertyValue &value) { WritePropertyValueImpl(this, value); }
+
 //////////////////////////
 // Decoder implementation.
 //////////////////////////
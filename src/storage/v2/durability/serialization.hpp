@@ -14,6 +14,7 @@
 #include <cstdint>
 #include <filesystem>
 #include <string_view>
+#include <vector>
 
 #include "storage/v2/config.hpp"
 #include "storage/v2/durability/marker.hpp"
@@ -62,6 +63,10 @@ class Encoder final : public BaseEncoder {
 
   void Sync();
 
+  // Write the internal buffer to the file and get a handle that can be used to
+  // sync the written data without accessing the encoder.
+  utils::FileSyncHandle SyncHandle();
+
   void Finalize();
 
   // Disable flushing of the internal buffer.
@@ -80,6 +85,29 @@ class Encoder final : public BaseEncoder {
   utils::OutputFile file_;
 };
 
+/// Encoder that writes into an in-memory buffer. Used to encode data whose
+/// final destination isn't known (or can't be accessed) at encoding time.
+class BufferEncoder final : public BaseEncoder {
+ public:
+  void Write(const uint8_t *data, uint64_t size);
+
+  void WriteMarker(Marker marker) override;
+  void WriteBool(bool value) override;
+  void WriteUint(uint64_t value) override;
+  void WriteDouble(double value) override;
+  void WriteString(std::string_view value) override;
+  void WritePropertyValue(const PropertyValue &value) override;
+
+  const uint8_t *data() const { return buffer_.data(); }
+  uint8_t *data() { return buffer_.data(); }
+  uint64_t size() const { return buffer_.size(); }
+
+  void Clear() { buffer_.clear(); }
+
+ private:
+  std::vector<uint8_t> buffer_;
+};
+
 /// Decoder interface class. Used to implement streams from different sources
 /// (e.g. file and network).
 class BaseDecoder {
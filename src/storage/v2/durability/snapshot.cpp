@@ -11,6 +11,9 @@
 
 #include "storage/v2/durability/snapshot.hpp"
 
+#include <condition_variable>
+#include <exception>
+#include <mutex>
 #include <thread>
 
 #include "storage/v2/durability/exceptions.hpp"
@@ -477,7 +480,7 @@ LoadPartialConnectivityResult LoadPartialConnectivity(const std::filesystem::pat
             edge_ref = EdgeRef(&*edge);
           }
         }
-        vertex.in_edges.emplace_back(get_edge_type_from_id(*edge_type), &*from_vertex, edge_ref);
+        vertex.in_edges.Add(get_edge_type_from_id(*edge_type), &*from_vertex, edge_ref);
       }
     }
 
@@ -513,7 +516,7 @@ LoadPartialConnectivityResult LoadPartialConnectivity(const std::filesystem::pat
             edge_ref = EdgeRef(&*edge);
           }
         }
-        vertex.out_edges.emplace_back(get_edge_type_from_id(*edge_type), &*to_vertex, edge_ref);
+        vertex.out_edges.Add(get_edge_type_from_id(*edge_type), &*to_vertex, edge_ref);
         // Increment edge count. We only increment the count here because the
         // information is duplicated in in_edges.
         edge_count++;
@@ -838,7 +841,7 @@ RecoveredSnapshot LoadSnapshotVersion14(const std::filesystem::path &path, utils
           }
           SPDLOG_TRACE("Recovered inbound edge {} with label \"{}\" from vertex {}.", *edge_gid,
                        name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)), from_vertex->gid.AsUint());
-          vertex.in_edges.emplace_back(get_edge_type_from_id(*edge_type), &*from_vertex, edge_ref);
+          vertex.in_edges.Add(get_edge_type_from_id(*edge_type), &*from_vertex, edge_ref);
         }
       }
 
@@ -874,7 +877,7 @@ RecoveredSnapshot LoadSnapshotVersion14(const std::filesystem::path &path, utils
           }
           SPDLOG_TRACE("Recovered outbound edge {} with label \"{}\" to vertex {}.", *edge_gid,
                        name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)), to_vertex->gid.AsUint());
-          vertex.out_edges.emplace_back(get_edge_type_from_id(*edge_type), &*to_vertex, edge_ref);
+          vertex.out_edges.Add(get_edge_type_from_id(*edge_type), &*to_vertex, edge_ref);
         }
         // Increment edge count. We only increment the count here because the
         // information is duplicated in in_edges.
@@ -1312,6 +1315,239 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
   return {info, recovery_info, std::move(indices_constraints)};
 }
 
+namespace {
+
+void WriteMapping(BaseEncoder &encoder, uint64_t mapping, std::unordered_set<uint64_t> &used_ids) {
+  used_ids.insert(mapping);
+  encoder.WriteUint(mapping);
+}
+
+/// Encodes the edge if it is visible to the transaction. Returns whether the
+/// edge was encoded.
+bool EncodeEdge(BaseEncoder &encoder, Edge &edge, Transaction *transaction, Indices *indices, Constraints *constraints,
+                const Config &config, std::unordered_set<uint64_t> &used_ids) {
+  // The edge visibility check must be done here manually because we don't
+  // allow direct access to the edges through the public API.
+  bool is_visible = true;
+  Delta *delta = nullptr;
+  {
+    std::lock_guard<utils::SpinLock> guard(edge.lock);
+    is_visible = !edge.deleted;
+    delta = edge.delta;
+  }
+  ApplyDeltasForRead(transaction, delta, View::OLD, [&is_visible](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::ADD_LABEL:
+      case Delta::Action::REMOVE_LABEL:
+      case Delta::Action::SET_PROPERTY:
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::ADD_OUT_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::REMOVE_OUT_EDGE:
+        break;
+      case Delta::Action::RECREATE_OBJECT: {
+        is_visible = true;
+        break;
+      }
+      case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+      case Delta::Action::DELETE_OBJECT: {
+        is_visible = false;
+        break;
+      }
+    }
+  });
+  if (!is_visible) return false;
+  EdgeRef edge_ref(&edge);
+  // Here we create an edge accessor that we will use to get the
+  // properties of the edge. The accessor is created with an invalid
+  // type and invalid from/to pointers because we don't know them here,
+  // but that isn't an issue because we won't use that part of the API
+  // here.
+  auto ea = EdgeAccessor{
+      edge_ref, EdgeTypeId::FromUint(0UL), nullptr, nullptr, transaction, indices, constraints, config.items};
+
+  // Get edge data.
+  auto maybe_props = ea.Properties(View::OLD);
+  MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
+
+  // Store the edge.
+  encoder.WriteMarker(Marker::SECTION_EDGE);
+  encoder.WriteUint(edge.gid.AsUint());
+  const auto &props = maybe_props.GetValue();
+  encoder.WriteUint(props.size());
+  for (const auto &item : props) {
+    WriteMapping(encoder, item.first.AsUint(), used_ids);
+    encoder.WritePropertyValue(item.second);
+  }
+  return true;
+}
+
+/// Encodes the vertex if it is visible to the transaction. Returns whether the
+/// vertex was encoded.
+bool EncodeVertex(BaseEncoder &encoder, Vertex &vertex, Transaction *transaction, Indices *indices,
+                  Constraints *constraints, const Config &config, std::unordered_set<uint64_t> &used_ids) {
+  // The visibility check is implemented for vertices so we use it here.
+  auto va = VertexAccessor::Create(&vertex, transaction, indices, constraints, config.items, View::OLD);
+  if (!va) return false;
+
+  // Get vertex data.
+  // TODO (mferencevic): All of these functions could be written into a
+  // single function so that we traverse the undo deltas only once.
+  auto maybe_labels = va->Labels(View::OLD);
+  MG_ASSERT(maybe_labels.HasValue(), "Invalid database state!");
+  auto maybe_props = va->Properties(View::OLD);
+  MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
+  auto maybe_in_edges = va->InEdges(View::OLD);
+  MG_ASSERT(maybe_in_edges.HasValue(), "Invalid database state!");
+  auto maybe_out_edges = va->OutEdges(View::OLD);
+  MG_ASSERT(maybe_out_edges.HasValue(), "Invalid database state!");
+
+  // Store the vertex.
+  encoder.WriteMarker(Marker::SECTION_VERTEX);
+  encoder.WriteUint(vertex.gid.AsUint());
+  const auto &labels = maybe_labels.GetValue();
+  encoder.WriteUint(labels.size());
+  for (const auto &item : labels) {
+    WriteMapping(encoder, item.AsUint(), used_ids);
+  }
+  const auto &props = maybe_props.GetValue();
+  encoder.WriteUint(props.size());
+  for (const auto &item : props) {
+    WriteMapping(encoder, item.first.AsUint(), used_ids);
+    encoder.WritePropertyValue(item.second);
+  }
+  const auto &in_edges = maybe_in_edges.GetValue();
+  encoder.WriteUint(in_edges.size());
+  for (const auto &item : in_edges) {
+    encoder.WriteUint(item.Gid().AsUint());
+    encoder.WriteUint(item.FromVertex().Gid().AsUint());
+    WriteMapping(encoder, item.EdgeType().AsUint(), used_ids);
+  }
+  const auto &out_edges = maybe_out_edges.GetValue();
+  encoder.WriteUint(out_edges.size());
+  for (const auto &item : out_edges) {
+    encoder.WriteUint(item.Gid().AsUint());
+    encoder.WriteUint(item.ToVertex().Gid().AsUint());
+    WriteMapping(encoder, item.EdgeType().AsUint(), used_ids);
+  }
+  return true;
+}
+
+}  // namespace
+
+/// Splits the objects of the skip list into ranges of `items_per_batch`
+/// objects, encodes the ranges on `thread_count` threads and writes them into
+/// the snapshot in order. At most `2 * thread_count` encoded ranges are kept in
+/// memory at once. Each written range becomes one batch; ranges in which no
+/// object was visible are left out. Returns the batches and the total number
+/// of written objects.
+/// Each thread reads through its own copy of the snapshot transaction because
+/// the delta chain cache of a transaction isn't thread safe. The copies see
+/// the same versions since the snapshot transaction doesn't modify anything.
+template <typename TObj, typename TFunc>
+std::pair<std::vector<BatchInfo>, uint64_t> EncodeObjectsOnMultipleThreads(
+    Encoder *snapshot, utils::SkipList<TObj> *objects, uint64_t items_per_batch, uint64_t thread_count,
+    const Transaction &transaction, std::unordered_set<uint64_t> *used_ids, const TFunc &encode_object) {
+  auto acc = objects->access();
+  // Ranges are delimited by gids and not by iterators because the objects at
+  // the range boundaries could be removed from the skip list in the meantime.
+  std::vector<Gid> range_starts;
+  {
+    uint64_t position = 0;
+    for (const auto &object : acc) {
+      if (position++ % std::max(items_per_batch, uint64_t{1}) == 0) {
+        range_starts.push_back(object.gid);
+      }
+    }
+  }
+  const auto range_count = range_starts.size();
+  thread_count = std::min(thread_count, std::max(range_count, size_t{1}));
+  const auto window = 2 * thread_count;
+
+  struct EncodedRange {
+    BufferEncoder buffer;
+    uint64_t count{0};
+  };
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<std::optional<EncodedRange>> ready(window);
+  uint64_t next_to_write = 0;
+  std::exception_ptr error;
+  std::atomic<uint64_t> range_counter = 0;
+  std::vector<std::unordered_set<uint64_t>> thread_used_ids(thread_count);
+
+  std::vector<BatchInfo> batch_infos;
+  uint64_t objects_count = 0;
+  {
+    std::vector<std::jthread> threads;
+    threads.reserve(thread_count);
+    for (uint64_t i = 0; i < thread_count; ++i) {
+      threads.emplace_back([&, thread_id = i]() {
+        Transaction thread_transaction(transaction.transaction_id.load(std::memory_order_acquire),
+                                       transaction.start_timestamp, transaction.isolation_level,
+                                       transaction.storage_mode);
+        thread_transaction.command_id = transaction.command_id;
+        while (true) {
+          const auto range_index = range_counter++;
+          if (range_index >= range_count) return;
+          {
+            // Don't run too far ahead of the writer.
+            std::unique_lock guard(mutex);
+            cv.wait(guard, [&] { return range_index < next_to_write + window || error; });
+            if (error) return;
+          }
+          EncodedRange encoded;
+          try {
+            auto it = acc.find_equal_or_greater(range_starts[range_index]);
+            for (; it != acc.end(); ++it) {
+              if (range_index + 1 < range_count && it->gid >= range_starts[range_index + 1]) break;
+              if (encode_object(encoded.buffer, *it, &thread_transaction, thread_used_ids[thread_id])) {
+                ++encoded.count;
+              }
+            }
+          } catch (...) {
+            std::lock_guard guard(mutex);
+            error = std::current_exception();
+            cv.notify_all();
+            return;
+          }
+          {
+            std::lock_guard guard(mutex);
+            ready[range_index % window] = std::move(encoded);
+          }
+          cv.notify_all();
+        }
+      });
+    }
+
+    for (uint64_t range_index = 0; range_index < range_count; ++range_index) {
+      EncodedRange encoded;
+      {
+        std::unique_lock guard(mutex);
+        cv.wait(guard, [&] { return ready[range_index % window].has_value() || error; });
+        if (error) break;
+        encoded = std::move(*ready[range_index % window]);
+        ready[range_index % window].reset();
+        ++next_to_write;
+      }
+      cv.notify_all();
+      if (encoded.count == 0) continue;
+      batch_infos.push_back(BatchInfo{snapshot->GetPosition(), encoded.count});
+      snapshot->Write(encoded.buffer.data(), encoded.buffer.size());
+      objects_count += encoded.count;
+    }
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+
+  for (const auto &ids : thread_used_ids) {
+    used_ids->insert(ids.begin(), ids.end());
+  }
+  return {std::move(batch_infos), objects_count};
+}
+
 void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snapshot_directory,
                     const std::filesystem::path &wal_directory, uint64_t snapshot_retention_count,
                     utils::SkipList<Vertex> *vertices, utils::SkipList<Edge> *edges, NameIdMapper *name_id_mapper,
@@ -1363,152 +1599,32 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
     snapshot.WriteUint(mapping.AsUint());
   };
 
+  const auto thread_count = config.durability.allow_parallel_snapshot_creation
+                                ? std::max(config.durability.snapshot_thread_count, uint64_t{1})
+                                : uint64_t{1};
+
   std::vector<BatchInfo> edge_batch_infos;
-  auto items_in_current_batch{0UL};
-  auto batch_start_offset{0UL};
   // Store all edges.
   if (config.items.properties_on_edges) {
     offset_edges = snapshot.GetPosition();
-    batch_start_offset = offset_edges;
-    auto acc = edges->access();
-    for (auto &edge : acc) {
-      // The edge visibility check must be done here manually because we don't
-      // allow direct access to the edges through the public API.
-      bool is_visible = true;
-      Delta *delta = nullptr;
-      {
-        std::lock_guard<utils::SpinLock> guard(edge.lock);
-        is_visible = !edge.deleted;
-        delta = edge.delta;
-      }
-      ApplyDeltasForRead(transaction, delta, View::OLD, [&is_visible](const Delta &delta) {
-        switch (delta.action) {
-          case Delta::Action::ADD_LABEL:
-          case Delta::Action::REMOVE_LABEL:
-          case Delta::Action::SET_PROPERTY:
-          case Delta::Action::ADD_IN_EDGE:
-          case Delta::Action::ADD_OUT_EDGE:
-          case Delta::Action::REMOVE_IN_EDGE:
-          case Delta::Action::REMOVE_OUT_EDGE:
-            break;
-          case Delta::Action::RECREATE_OBJECT: {
-            is_visible = true;
-            break;
-          }
-          case Delta::Action::DELETE_DESERIALIZED_OBJECT:
-          case Delta::Action::DELETE_OBJECT: {
-            is_visible = false;
-            break;
-          }
-        }
-      });
-      if (!is_visible) continue;
-      EdgeRef edge_ref(&edge);
-      // Here we create an edge accessor that we will use to get the
-      // properties of the edge. The accessor is created with an invalid
-      // type and invalid from/to pointers because we don't know them here,
-      // but that isn't an issue because we won't use that part of the API
-      // here.
-      auto ea = EdgeAccessor{
-          edge_ref, EdgeTypeId::FromUint(0UL), nullptr, nullptr, transaction, indices, constraints, config.items};
-
-      // Get edge data.
-      auto maybe_props = ea.Properties(View::OLD);
-      MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
-
-      // Store the edge.
-      {
-        snapshot.WriteMarker(Marker::SECTION_EDGE);
-        snapshot.WriteUint(edge.gid.AsUint());
-        const auto &props = maybe_props.GetValue();
-        snapshot.WriteUint(props.size());
-        for (const auto &item : props) {
-          write_mapping(item.first);
-          snapshot.WritePropertyValue(item.second);
-        }
-      }
-
-      ++edges_count;
-      ++items_in_current_batch;
-      if (items_in_current_batch == config.durability.items_per_batch) {
-        edge_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
-        batch_start_offset = snapshot.GetPosition();
-        items_in_current_batch = 0;
-      }
-    }
-  }
-
-  if (items_in_current_batch > 0) {
-    edge_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
+    std::tie(edge_batch_infos, edges_count) = EncodeObjectsOnMultipleThreads(
+        &snapshot, edges, config.durability.items_per_batch, thread_count, *transaction, &used_ids,
+        [&](BaseEncoder &encoder, Edge &edge, Transaction *thread_transaction,
+            std::unordered_set<uint64_t> &batch_used_ids) {
+          return EncodeEdge(encoder, edge, thread_transaction, indices, constraints, config, batch_used_ids);
+        });
   }
 
   std::vector<BatchInfo> vertex_batch_infos;
   // Store all vertices.
   {
-    items_in_current_batch = 0;
     offset_vertices = snapshot.GetPosition();
-    batch_start_offset = offset_vertices;
-    auto acc = vertices->access();
-    for (auto &vertex : acc) {
-      // The visibility check is implemented for vertices so we use it here.
-      auto va = VertexAccessor::Create(&vertex, transaction, indices, constraints, config.items, View::OLD);
-      if (!va) continue;
-
-      // Get vertex data.
-      // TODO (mferencevic): All of these functions could be written into a
-      // single function so that we traverse the undo deltas only once.
-      auto maybe_labels = va->Labels(View::OLD);
-      MG_ASSERT(maybe_labels.HasValue(), "Invalid database state!");
-      auto maybe_props = va->Properties(View::OLD);
-      MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
-      auto maybe_in_edges = va->InEdges(View::OLD);
-      MG_ASSERT(maybe_in_edges.HasValue(), "Invalid database state!");
-      auto maybe_out_edges = va->OutEdges(View::OLD);
-      MG_ASSERT(maybe_out_edges.HasValue(), "Invalid database state!");
-
-      // Store the vertex.
-      {
-        snapshot.WriteMarker(Marker::SECTION_VERTEX);
-        snapshot.WriteUint(vertex.gid.AsUint());
-        const auto &labels = maybe_labels.GetValue();
-        snapshot.WriteUint(labels.size());
-        for (const auto &item : labels) {
-          write_mapping(item);
-        }
-        const auto &props = maybe_props.GetValue();
-        snapshot.WriteUint(props.size());
-        for (const auto &item : props) {
-          write_mapping(item.first);
-          snapshot.WritePropertyValue(item.second);
-        }
-        const auto &in_edges = maybe_in_edges.GetValue();
-        snapshot.WriteUint(in_edges.size());
-        for (const auto &item : in_edges) {
-          snapshot.WriteUint(item.Gid().AsUint());
-          snapshot.WriteUint(item.FromVertex().Gid().AsUint());
-          write_mapping(item.EdgeType());
-        }
-        const auto &out_edges = maybe_out_edges.GetValue();
-        snapshot.WriteUint(out_edges.size());
-        for (const auto &item : out_edges) {
-          snapshot.WriteUint(item.Gid().AsUint());
-          snapshot.WriteUint(item.ToVertex().Gid().AsUint());
-          write_mapping(item.EdgeType());
-        }
-      }
-
-      ++vertices_count;
-      ++items_in_current_batch;
-      if (items_in_current_batch == config.durability.items_per_batch) {
-        vertex_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
-        batch_start_offset = snapshot.GetPosition();
-        items_in_current_batch = 0;
-      }
-    }
-
-    if (items_in_current_batch > 0) {
-      vertex_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
-    }
+    std::tie(vertex_batch_infos, vertices_count) = EncodeObjectsOnMultipleThreads(
+        &snapshot, vertices, config.durability.items_per_batch, thread_count, *transaction, &used_ids,
+        [&](BaseEncoder &encoder, Vertex &vertex, Transaction *thread_transaction,
+            std::unordered_set<uint64_t> &batch_used_ids) {
+          return EncodeVertex(encoder, vertex, thread_transaction, indices, constraints, config, batch_used_ids);
+        });
   }
 
   // Write indices.
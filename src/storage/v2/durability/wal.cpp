@@ -11,12 +11,15 @@
 
 #include "storage/v2/durability/wal.hpp"
 
+#include <cstring>
+
 #include "storage/v2/delta.hpp"
 #include "storage/v2/durability/exceptions.hpp"
 #include "storage/v2/durability/paths.hpp"
 #include "storage/v2/durability/version.hpp"
 #include "storage/v2/edge.hpp"
 #include "storage/v2/vertex.hpp"
+#include "utils/endian.hpp"
 #include "utils/file_locker.hpp"
 #include "utils/logging.hpp"
 
@@ -720,18 +723,14 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
             if (!inserted) throw RecoveryFailure("The edge must be inserted here!");
             edge_ref = EdgeRef(&*edge);
           }
-          {
-            std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*to_vertex, edge_ref};
-            auto it = std::find(from_vertex->out_edges.begin(), from_vertex->out_edges.end(), link);
-            if (it != from_vertex->out_edges.end()) throw RecoveryFailure("The from vertex already has this edge!");
-            from_vertex->out_edges.push_back(link);
+          if (from_vertex->out_edges.Contains(edge_type_id, &*to_vertex, edge_ref)) {
+            throw RecoveryFailure("The from vertex already has this edge!");
           }
-          {
-            std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*from_vertex, edge_ref};
-            auto it = std::find(to_vertex->in_edges.begin(), to_vertex->in_edges.end(), link);
-            if (it != to_vertex->in_edges.end()) throw RecoveryFailure("The to vertex already has this edge!");
-            to_vertex->in_edges.push_back(link);
+          from_vertex->out_edges.Add(edge_type_id, &*to_vertex, edge_ref);
+          if (to_vertex->in_edges.Contains(edge_type_id, &*from_vertex, edge_ref)) {
+            throw RecoveryFailure("The to vertex already has this edge!");
           }
+          to_vertex->in_edges.Add(edge_type_id, &*from_vertex, edge_ref);
 
           ret.next_edge_id = std::max(ret.next_edge_id, edge_gid.AsUint() + 1);
 
@@ -754,19 +753,11 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
             if (edge == edge_acc.end()) throw RecoveryFailure("The edge doesn't exist!");
             edge_ref = EdgeRef(&*edge);
           }
-          {
-            std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*to_vertex, edge_ref};
-            auto it = std::find(from_vertex->out_edges.begin(), from_vertex->out_edges.end(), link);
-            if (it == from_vertex->out_edges.end()) throw RecoveryFailure("The from vertex doesn't have this edge!");
-            std::swap(*it, from_vertex->out_edges.back());
-            from_vertex->out_edges.pop_back();
+          if (!from_vertex->out_edges.Remove(edge_type_id, &*to_vertex, edge_ref)) {
+            throw RecoveryFailure("The from vertex doesn't have this edge!");
           }
-          {
-            std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*from_vertex, edge_ref};
-            auto it = std::find(to_vertex->in_edges.begin(), to_vertex->in_edges.end(), link);
-            if (it == to_vertex->in_edges.end()) throw RecoveryFailure("The to vertex doesn't have this edge!");
-            std::swap(*it, to_vertex->in_edges.back());
-            to_vertex->in_edges.pop_back();
+          if (!to_vertex->in_edges.Remove(edge_type_id, &*from_vertex, edge_ref)) {
+            throw RecoveryFailure("The to vertex doesn't have this edge!");
           }
           if (items.properties_on_edges) {
             if (!edge_acc.remove(edge_gid)) throw RecoveryFailure("The edge must be removed here!");
@@ -865,6 +856,33 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
   return ret;
 }
 
+WalDeltasBuffer::WalDeltasBuffer(Config::Items items, NameIdMapper *name_id_mapper)
+    : items_(items), name_id_mapper_(name_id_mapper) {}
+
+namespace {
+// Each delta starts with the `SECTION_DELTA` marker followed by the timestamp
+// encoded with `WriteUint` (a `TYPE_INT` marker and the little endian value).
+constexpr uint64_t kDeltaTimestampOffset = 2 * sizeof(Marker);
+}  // namespace
+
+void WalDeltasBuffer::AppendDelta(const Delta &delta, const Vertex &vertex) {
+  timestamp_offsets_.push_back(buffer_.size() + kDeltaTimestampOffset);
+  EncodeDelta(&buffer_, name_id_mapper_, items_, delta, vertex, 0);
+}
+
+void WalDeltasBuffer::AppendDelta(const Delta &delta, const Edge &edge) {
+  timestamp_offsets_.push_back(buffer_.size() + kDeltaTimestampOffset);
+  EncodeDelta(&buffer_, name_id_mapper_, delta, edge, 0);
+}
+
+void WalDeltasBuffer::SetTimestamp(uint64_t timestamp) {
+  const auto encoded = utils::HostToLittleEndian(timestamp);
+  for (const auto offset : timestamp_offsets_) {
+    MG_ASSERT(offset + sizeof(encoded) <= buffer_.size(), "Invalid WAL delta offset!");
+    memcpy(buffer_.data() + offset, &encoded, sizeof(encoded));
+  }
+}
+
 WalFile::WalFile(const std::filesystem::path &wal_directory, const std::string_view uuid,
                  const std::string_view epoch_id, Config::Items items, NameIdMapper *name_id_mapper, uint64_t seq_num,
                  utils::FileRetainer *file_retainer)
@@ -959,6 +977,15 @@ void WalFile::AppendDelta(const Delta &delta, const Edge &edge, uint64_t timesta
   UpdateStats(timestamp);
 }
 
+void WalFile::AppendDeltas(WalDeltasBuffer &deltas, uint64_t timestamp) {
+  if (deltas.DeltaCount() == 0) return;
+  deltas.SetTimestamp(timestamp);
+  wal_.Write(deltas.buffer_.data(), deltas.buffer_.size());
+  if (count_ == 0) from_timestamp_ = timestamp;
+  to_timestamp_ = timestamp;
+  count_ += deltas.DeltaCount();
+}
+
 void WalFile::AppendTransactionEnd(uint64_t timestamp) {
   EncodeTransactionEnd(&wal_, timestamp);
   UpdateStats(timestamp);
@@ -972,6 +999,8 @@ void WalFile::AppendOperation(StorageGlobalOperation operation, LabelId label, c
 
 void WalFile::Sync() { wal_.Sync(); }
 
+utils::FileSyncHandle WalFile::SyncHandle() { return wal_.SyncHandle(); }
+
 uint64_t WalFile::GetSize() { return wal_.GetSize(); }
 
 uint64_t WalFile::SequenceNumber() const { return seq_num_; }
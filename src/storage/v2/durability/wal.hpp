@@ -195,6 +195,33 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
                      utils::SkipList<Edge> *edges, NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count,
                      Config::Items items);
 
+/// Buffer holding the encoded WAL deltas of a single transaction. The deltas
+/// are encoded before the commit timestamp of the transaction is known, so
+/// that the expensive encoding can be done without holding the engine lock.
+/// The timestamps are patched in by `WalFile::AppendDeltas` once the commit
+/// timestamp is assigned.
+class WalDeltasBuffer {
+ public:
+  WalDeltasBuffer(Config::Items items, NameIdMapper *name_id_mapper);
+
+  void AppendDelta(const Delta &delta, const Vertex &vertex);
+  void AppendDelta(const Delta &delta, const Edge &edge);
+
+  uint64_t DeltaCount() const { return timestamp_offsets_.size(); }
+
+ private:
+  friend class WalFile;
+
+  // Overwrites the placeholder timestamps of all deltas.
+  void SetTimestamp(uint64_t timestamp);
+
+  Config::Items items_;
+  NameIdMapper *name_id_mapper_;
+  BufferEncoder buffer_;
+  // Offsets of the encoded timestamp value of each delta.
+  std::vector<uint64_t> timestamp_offsets_;
+};
+
 /// WalFile class used to append deltas and operations to the WAL file.
 class WalFile {
  public:
@@ -213,6 +240,10 @@ class WalFile {
   void AppendDelta(const Delta &delta, const Vertex &vertex, uint64_t timestamp);
   void AppendDelta(const Delta &delta, const Edge &edge, uint64_t timestamp);
 
+  /// Appends the pre-encoded deltas of a transaction with the given commit
+  /// timestamp.
+  void AppendDeltas(WalDeltasBuffer &deltas, uint64_t timestamp);
+
   void AppendTransactionEnd(uint64_t timestamp);
 
   void AppendOperation(StorageGlobalOperation operation, LabelId label, const std::set<PropertyId> &properties,
@@ -220,6 +251,10 @@ class WalFile {
 
   void Sync();
 
+  /// Writes buffered data to the file and returns a handle used to sync it
+  /// without holding the lock that guards this WAL file.
+  utils::FileSyncHandle SyncHandle();
+
   uint64_t GetSize();
 
   uint64_t SequenceNumber() const;
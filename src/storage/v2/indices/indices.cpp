@@ -20,6 +20,25 @@ void Indices::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) cons
       ->RemoveObsoleteEntries(oldest_active_start_timestamp);
 }
 
+void Indices::RemoveObsoleteEntries(IndexGcCandidates *candidates, uint64_t oldest_active_start_timestamp) const {
+  static_cast<InMemoryLabelIndex *>(label_index_.get())
+      ->RemoveObsoleteEntries(&candidates->label, oldest_active_start_timestamp);
+  static_cast<InMemoryLabelPropertyIndex *>(label_property_index_.get())
+      ->RemoveObsoleteEntries(&candidates->label_property, oldest_active_start_timestamp);
+}
+
+void Indices::CollectGcCandidatesOnRemoveLabel(LabelId label, Vertex *vertex, IndexGcCandidates *candidates) const {
+  static_cast<InMemoryLabelIndex *>(label_index_.get())->CollectGcCandidates(label, vertex, candidates);
+  static_cast<InMemoryLabelPropertyIndex *>(label_property_index_.get())
+      ->CollectGcCandidates(label, vertex, candidates);
+}
+
+void Indices::CollectGcCandidatesOnSetProperty(PropertyId property, const PropertyValue &old_value, Vertex *vertex,
+                                               IndexGcCandidates *candidates) const {
+  static_cast<InMemoryLabelPropertyIndex *>(label_property_index_.get())
+      ->CollectGcCandidates(property, old_value, vertex, candidates);
+}
+
 void Indices::UpdateOnAddLabel(LabelId label, Vertex *vertex, const Transaction &tx) const {
   label_index_->UpdateOnAddLabel(label, vertex, tx);
   label_property_index_->UpdateOnAddLabel(label, vertex, tx);
@@ -46,6 +46,19 @@ struct Indices {
   /// TODO: unused in disk indices
   void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) const;
 
+  /// Same as above, but only the entries recorded in `candidates` are checked
+  /// instead of all of the entries in every index.
+  void RemoveObsoleteEntries(IndexGcCandidates *candidates, uint64_t oldest_active_start_timestamp) const;
+
+  /// These functions record the index entries that could become obsolete
+  /// because of a change, so that the garbage collector doesn't have to scan
+  /// the whole index to find them. They should be called before the label is
+  /// removed or the property is changed. Unused in disk indices.
+  /// @throw std::bad_alloc
+  void CollectGcCandidatesOnRemoveLabel(LabelId label, Vertex *vertex, IndexGcCandidates *candidates) const;
+  void CollectGcCandidatesOnSetProperty(PropertyId property, const PropertyValue &old_value, Vertex *vertex,
+                                        IndexGcCandidates *candidates) const;
+
   // Indices are updated whenever an update occurs, instead of only on commit or
   // advance command. This is necessary because we want indices to support `NEW`
   // view for use in Merge.
@@ -17,6 +17,11 @@
 
 namespace memgraph::storage {
 
+struct LabelIndexStats {
+  uint64_t count;
+  double avg_degree;
+};
+
 class LabelIndex {
  public:
   LabelIndex(Indices *indices, Constraints *constraints, const Config &config)
@@ -39,6 +44,9 @@ class LabelIndex {
 
   virtual std::vector<LabelId> ListIndices() const = 0;
 
+  /// Indices which are still being built, with the fraction of the build done.
+  virtual std::vector<std::pair<LabelId, double>> ListPopulatingIndices() const { return {}; }
+
   virtual uint64_t ApproximateVertexCount(LabelId label) const = 0;
 
  protected:
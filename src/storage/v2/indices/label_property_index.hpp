@@ -17,6 +17,11 @@
 
 namespace memgraph::storage {
 
+struct LabelPropertyIndexStats {
+  uint64_t count, distinct_values_count;
+  double statistic, avg_group_size, avg_degree;
+};
+
 class LabelPropertyIndex {
  public:
   LabelPropertyIndex(Indices *indices, Constraints *constraints, const Config &config)
@@ -42,6 +47,9 @@ class LabelPropertyIndex {
 
   virtual std::vector<std::pair<LabelId, PropertyId>> ListIndices() const = 0;
 
+  /// Indices which are still being built, with the fraction of the build done.
+  virtual std::vector<std::pair<std::pair<LabelId, PropertyId>, double>> ListPopulatingIndices() const { return {}; }
+
   virtual uint64_t ApproximateVertexCount(LabelId label, PropertyId property) const = 0;
 
   virtual uint64_t ApproximateVertexCount(LabelId label, PropertyId property, const PropertyValue &value) const = 0;
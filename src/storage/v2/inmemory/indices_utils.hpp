@@ -44,18 +44,9 @@ inline bool AnyVersionSatisfiesPredicate(uint64_t timestamp, const Delta *delta,
   return false;
 }
 
-/// Helper function for label index garbage collection. Returns true if there's
-/// a reachable version of the vertex that has the given label.
-inline bool AnyVersionHasLabel(const Vertex &vertex, LabelId label, uint64_t timestamp) {
-  bool has_label{false};
-  bool deleted{false};
-  const Delta *delta = nullptr;
-  {
-    std::lock_guard<utils::SpinLock> guard(vertex.lock);
-    has_label = utils::Contains(vertex.labels, label);
-    deleted = vertex.deleted;
-    delta = vertex.delta;
-  }
+/// Returns true if the version described by `has_label` and `deleted` or any
+/// older version reachable through `delta` has the given label.
+inline bool AnyVersionHasLabel(bool has_label, bool deleted, const Delta *delta, LabelId label, uint64_t timestamp) {
   if (!deleted && has_label) {
     return true;
   }
@@ -95,6 +86,21 @@ inline bool AnyVersionHasLabel(const Vertex &vertex, LabelId label, uint64_t tim
   });
 }
 
+/// Helper function for label index garbage collection. Returns true if there's
+/// a reachable version of the vertex that has the given label.
+inline bool AnyVersionHasLabel(const Vertex &vertex, LabelId label, uint64_t timestamp) {
+  bool has_label{false};
+  bool deleted{false};
+  const Delta *delta = nullptr;
+  {
+    std::lock_guard<utils::SpinLock> guard(vertex.lock);
+    has_label = utils::Contains(vertex.labels, label);
+    deleted = vertex.deleted;
+    delta = vertex.delta;
+  }
+  return AnyVersionHasLabel(has_label, deleted, delta, label, timestamp);
+}
+
 /// Helper function for label-property index garbage collection. Returns true if
 /// there's a reachable version of the vertex that has the given label and
 /// property value.
@@ -238,6 +244,66 @@ inline void TryInsertLabelPropertyIndex(Vertex &vertex, std::pair<LabelId, Prope
   index_accessor.insert({std::move(value), &vertex, 0});
 }
 
+/// Inserts the vertex into the label index if any version in its delta chain
+/// has the label. Used while the index is populated concurrently with writers:
+/// a writer that removes the label or deletes the vertex and aborts afterwards
+/// restores a version which isn't inserted into the index by anyone else.
+/// The vertex lock has to be held so that the delta chain isn't unlinked.
+template <typename TIndexAccessor>
+inline void TryInsertLabelIndexAnyVersion(Vertex &vertex, LabelId label, TIndexAccessor &index_accessor) {
+  if (!AnyVersionHasLabel(utils::Contains(vertex.labels, label), vertex.deleted, vertex.delta, label, 0)) {
+    return;
+  }
+
+  index_accessor.insert({&vertex, 0});
+}
+
+/// Label-property counterpart of `TryInsertLabelIndexAnyVersion`. Every
+/// distinct property value found in the delta chain gets its own entry.
+template <typename TIndexAccessor>
+inline void TryInsertLabelPropertyIndexAnyVersion(Vertex &vertex, std::pair<LabelId, PropertyId> label_property_pair,
+                                                  TIndexAccessor &index_accessor) {
+  const auto label = label_property_pair.first;
+  const auto key = label_property_pair.second;
+  bool has_label = utils::Contains(vertex.labels, label);
+  bool deleted = vertex.deleted;
+  auto value = vertex.properties.GetProperty(key);
+  const auto try_insert = [&] {
+    if (!deleted && has_label && !value.IsNull()) {
+      index_accessor.insert({value, &vertex, 0});
+    }
+  };
+
+  try_insert();
+  AnyVersionSatisfiesPredicate(0, vertex.delta, [&](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::ADD_LABEL:
+        if (delta.label == label) has_label = true;
+        break;
+      case Delta::Action::REMOVE_LABEL:
+        if (delta.label == label) has_label = false;
+        break;
+      case Delta::Action::SET_PROPERTY:
+        if (delta.property.key == key) value = delta.property.value;
+        break;
+      case Delta::Action::RECREATE_OBJECT:
+        deleted = false;
+        break;
+      case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+      case Delta::Action::DELETE_OBJECT:
+        deleted = true;
+        break;
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::ADD_OUT_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::REMOVE_OUT_EDGE:
+        break;
+    }
+    try_insert();
+    return false;
+  });
+}
+
 template <typename TSkiplistIter, typename TIndex, typename TIndexKey, typename TFunc>
 inline void CreateIndexOnSingleThread(utils::SkipList<Vertex>::Accessor &vertices, TSkiplistIter it, TIndex &index,
                                       TIndexKey key, const TFunc &func) {
@@ -305,4 +371,24 @@ inline void CreateIndexOnMultipleThreads(utils::SkipList<Vertex>::Accessor &vert
   }
 }
 
+/// Populates an index which is already visible to writers, so vertices may be
+/// modified concurrently. Each vertex is inspected under its lock; changes made
+/// after the vertex was visited are inserted into the index by the writers
+/// themselves. `func` has to insert every version of the vertex that is still
+/// in its delta chain, because uncommitted changes may be aborted later.
+/// `scanned` is advanced as the scan progresses.
+/// @throw utils::OutOfMemoryException
+template <typename TIndexAccessor, typename TIndexKey, typename TFunc>
+inline void PopulateIndexOnline(utils::SkipList<Vertex>::Accessor &vertices, TIndexAccessor &index_accessor,
+                                TIndexKey key, std::atomic<uint64_t> &scanned, const TFunc &func) {
+  utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+  for (Vertex &vertex : vertices) {
+    {
+      std::lock_guard<utils::SpinLock> guard(vertex.lock);
+      func(vertex, key, index_accessor);
+    }
+    scanned.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
 }  // namespace memgraph::storage
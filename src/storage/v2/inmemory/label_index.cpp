@@ -63,14 +63,66 @@ bool InMemoryLabelIndex::CreateIndex(LabelId label, utils::SkipList<Vertex>::Acc
   return create_index_seq(label, vertices, it);
 }
 
-bool InMemoryLabelIndex::DropIndex(LabelId label) { return index_.erase(label) > 0; }
+bool InMemoryLabelIndex::RegisterIndex(LabelId label, uint64_t vertex_count) {
+  auto [it, emplaced] = index_.emplace(std::piecewise_construct, std::forward_as_tuple(label), std::forward_as_tuple());
+  if (!emplaced) {
+    // Index already exists.
+    return false;
+  }
+  populating_.emplace(std::piecewise_construct, std::forward_as_tuple(label), std::forward_as_tuple())
+      .first->second.total = vertex_count;
+  return true;
+}
 
-bool InMemoryLabelIndex::IndexExists(LabelId label) const { return index_.find(label) != index_.end(); }
+void InMemoryLabelIndex::PopulateIndex(LabelId label, utils::SkipList<Vertex>::Accessor vertices) {
+  auto it = index_.find(label);
+  auto progress_it = populating_.find(label);
+  MG_ASSERT(it != index_.end() && progress_it != populating_.end(), "Index for label {} isn't being populated",
+            label.AsUint());
+  auto acc = it->second.access();
+  PopulateIndexOnline(vertices, acc, label, progress_it->second.scanned,
+                      [](Vertex &vertex, LabelId label, decltype(acc) &index_accessor) {
+                        TryInsertLabelIndexAnyVersion(vertex, label, index_accessor);
+                      });
+}
+
+void InMemoryLabelIndex::PublishIndex(LabelId label) {
+  const auto erased = populating_.erase(label);
+  MG_ASSERT(erased == 1, "Index for label {} isn't being populated", label.AsUint());
+}
+
+void InMemoryLabelIndex::DropPopulatingIndex(LabelId label) {
+  if (populating_.erase(label) > 0) {
+    index_.erase(label);
+  }
+}
+
+std::vector<std::pair<LabelId, double>> InMemoryLabelIndex::ListPopulatingIndices() const {
+  std::vector<std::pair<LabelId, double>> ret;
+  ret.reserve(populating_.size());
+  for (const auto &[label, progress] : populating_) {
+    const auto scanned = progress.scanned.load(std::memory_order_relaxed);
+    ret.emplace_back(label, progress.total == 0 ? 1.0 : std::min(1.0, static_cast<double>(scanned) / progress.total));
+  }
+  return ret;
+}
+
+bool InMemoryLabelIndex::DropIndex(LabelId label) {
+  if (populating_.contains(label)) {
+    return false;
+  }
+  return index_.erase(label) > 0;
+}
+
+bool InMemoryLabelIndex::IndexExists(LabelId label) const {
+  return index_.find(label) != index_.end() && !populating_.contains(label);
+}
 
 std::vector<LabelId> InMemoryLabelIndex::ListIndices() const {
   std::vector<LabelId> ret;
   ret.reserve(index_.size());
   for (const auto &item : index_) {
+    if (populating_.contains(item.first)) continue;
     ret.push_back(item.first);
   }
   return ret;
@@ -98,6 +150,42 @@ void InMemoryLabelIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_time
   }
 }
 
+void InMemoryLabelIndex::CollectGcCandidates(LabelId label, Vertex *vertex, IndexGcCandidates *candidates) const {
+  if (!index_.contains(label)) return;
+  candidates->label.emplace_back(label, vertex);
+}
+
+void InMemoryLabelIndex::RemoveObsoleteEntries(std::vector<std::pair<LabelId, Vertex *>> *candidates,
+                                               uint64_t oldest_active_start_timestamp) {
+  // Sorting groups the candidates by label, so every index is accessed once,
+  // and removes the candidates recorded more than once.
+  std::sort(candidates->begin(), candidates->end());
+  candidates->erase(std::unique(candidates->begin(), candidates->end()), candidates->end());
+
+  auto label_it = index_.end();
+  std::optional<utils::SkipList<Entry>::Accessor> vertices_acc;
+  for (const auto &[label, vertex] : *candidates) {
+    if (label_it == index_.end() || label_it->first != label) {
+      label_it = index_.find(label);
+      if (label_it == index_.end()) continue;
+      vertices_acc.emplace(label_it->second.access());
+    }
+    for (auto it = vertices_acc->find_equal_or_greater(Entry{vertex, 0});
+         it != vertices_acc->end() && it->vertex == vertex;) {
+      auto next_it = it;
+      ++next_it;
+
+      if (it->timestamp < oldest_active_start_timestamp &&
+          ((next_it != vertices_acc->end() && next_it->vertex == vertex) ||
+           !AnyVersionHasLabel(*vertex, label, oldest_active_start_timestamp))) {
+        vertices_acc->remove(*it);
+      }
+
+      it = next_it;
+    }
+  }
+}
+
 InMemoryLabelIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor, LabelId label, View view,
                                        Transaction *transaction, Indices *indices, Constraints *constraints,
                                        const Config &config)
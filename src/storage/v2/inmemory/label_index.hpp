@@ -11,16 +11,14 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "storage/v2/indices/label_index.hpp"
+#include "storage/v2/transaction.hpp"
 #include "storage/v2/vertex.hpp"
 
 namespace memgraph::storage {
 
-struct LabelIndexStats {
-  uint64_t count;
-  double avg_degree;
-};
-
 using ParallelizedIndexCreationInfo =
     std::pair<std::vector<std::pair<Gid, uint64_t>> /*vertex_recovery_info*/, uint64_t /*thread_count*/>;
 
@@ -48,6 +46,27 @@ class InMemoryLabelIndex : public storage::LabelIndex {
   bool CreateIndex(LabelId label, utils::SkipList<Vertex>::Accessor vertices,
                    const std::optional<ParallelizedIndexCreationInfo> &parallel_exec_info);
 
+  /// Online index creation is split into three steps. `RegisterIndex` adds an
+  /// empty index which writers start maintaining immediately, but which isn't
+  /// reported by `IndexExists` or `ListIndices`. `PopulateIndex` then inserts
+  /// the existing vertices while writers keep running, and `PublishIndex`
+  /// makes the complete index visible. The first and the last step must be
+  /// called with exclusive access to the storage.
+  /// Returns false if the index already exists or is being populated.
+  bool RegisterIndex(LabelId label, uint64_t vertex_count);
+
+  /// @throw utils::OutOfMemoryException
+  void PopulateIndex(LabelId label, utils::SkipList<Vertex>::Accessor vertices);
+
+  void PublishIndex(LabelId label);
+
+  /// Removes an index which was registered but never published.
+  void DropPopulatingIndex(LabelId label);
+
+  /// Returns the indices which are still being populated, together with the
+  /// fraction of vertices scanned so far.
+  std::vector<std::pair<LabelId, double>> ListPopulatingIndices() const override;
+
   /// Returns false if there was no index to drop
   bool DropIndex(LabelId label) override;
 
@@ -57,6 +76,15 @@ class InMemoryLabelIndex : public storage::LabelIndex {
 
   void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
 
+  /// Adds the entry of `vertex` under `label` to the candidates if the label
+  /// is indexed.
+  void CollectGcCandidates(LabelId label, Vertex *vertex, IndexGcCandidates *candidates) const;
+
+  /// Same as `RemoveObsoleteEntries`, but only checks the entries of the
+  /// given candidates instead of the whole index.
+  void RemoveObsoleteEntries(std::vector<std::pair<LabelId, Vertex *>> *candidates,
+                             uint64_t oldest_active_start_timestamp);
+
   class Iterable {
    public:
     Iterable(utils::SkipList<Entry>::Accessor index_accessor, LabelId label, View view, Transaction *transaction,
@@ -110,7 +138,13 @@ class InMemoryLabelIndex : public storage::LabelIndex {
   std::vector<LabelId> DeleteIndexStats(const storage::LabelId &label);
 
  private:
+  struct PopulationProgress {
+    std::atomic<uint64_t> scanned{0};
+    uint64_t total;
+  };
+
   std::map<LabelId, utils::SkipList<Entry>> index_;
+  std::map<LabelId, PopulationProgress> populating_;
   std::map<LabelId, storage::LabelIndexStats> stats_;
 };
 
@@ -108,18 +108,71 @@ void InMemoryLabelPropertyIndex::UpdateOnSetProperty(PropertyId property, const
   }
 }
 
+bool InMemoryLabelPropertyIndex::RegisterIndex(LabelId label, PropertyId property, uint64_t vertex_count) {
+  auto [it, emplaced] =
+      index_.emplace(std::piecewise_construct, std::forward_as_tuple(label, property), std::forward_as_tuple());
+  if (!emplaced) {
+    // Index already exists.
+    return false;
+  }
+  populating_.emplace(std::piecewise_construct, std::forward_as_tuple(label, property), std::forward_as_tuple())
+      .first->second.total = vertex_count;
+  return true;
+}
+
+void InMemoryLabelPropertyIndex::PopulateIndex(LabelId label, PropertyId property,
+                                               utils::SkipList<Vertex>::Accessor vertices) {
+  auto it = index_.find({label, property});
+  auto progress_it = populating_.find({label, property});
+  MG_ASSERT(it != index_.end() && progress_it != populating_.end(),
+            "Index for label {} and property {} isn't being populated", label.AsUint(), property.AsUint());
+  auto acc = it->second.access();
+  PopulateIndexOnline(vertices, acc, std::make_pair(label, property), progress_it->second.scanned,
+                      [](Vertex &vertex, std::pair<LabelId, PropertyId> key, decltype(acc) &index_accessor) {
+                        TryInsertLabelPropertyIndexAnyVersion(vertex, key, index_accessor);
+                      });
+}
+
+void InMemoryLabelPropertyIndex::PublishIndex(LabelId label, PropertyId property) {
+  const auto erased = populating_.erase({label, property});
+  MG_ASSERT(erased == 1, "Index for label {} and property {} isn't being populated", label.AsUint(),
+            property.AsUint());
+}
+
+void InMemoryLabelPropertyIndex::DropPopulatingIndex(LabelId label, PropertyId property) {
+  if (populating_.erase({label, property}) > 0) {
+    index_.erase({label, property});
+  }
+}
+
+std::vector<std::pair<std::pair<LabelId, PropertyId>, double>> InMemoryLabelPropertyIndex::ListPopulatingIndices()
+    const {
+  std::vector<std::pair<std::pair<LabelId, PropertyId>, double>> ret;
+  ret.reserve(populating_.size());
+  for (const auto &[label_property, progress] : populating_) {
+    const auto scanned = progress.scanned.load(std::memory_order_relaxed);
+    ret.emplace_back(label_property,
+                     progress.total == 0 ? 1.0 : std::min(1.0, static_cast<double>(scanned) / progress.total));
+  }
+  return ret;
+}
+
 bool InMemoryLabelPropertyIndex::DropIndex(LabelId label, PropertyId property) {
+  if (populating_.contains({label, property})) {
+    return false;
+  }
   return index_.erase({label, property}) > 0;
 }
 
 bool InMemoryLabelPropertyIndex::IndexExists(LabelId label, PropertyId property) const {
-  return index_.find({label, property}) != index_.end();
+  return index_.find({label, property}) != index_.end() && !populating_.contains({label, property});
 }
 
 std::vector<std::pair<LabelId, PropertyId>> InMemoryLabelPropertyIndex::ListIndices() const {
   std::vector<std::pair<LabelId, PropertyId>> ret;
   ret.reserve(index_.size());
   for (const auto &item : index_) {
+    if (populating_.contains(item.first)) continue;
     ret.push_back(item.first);
   }
   return ret;
@@ -147,6 +200,57 @@ void InMemoryLabelPropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_st
   }
 }
 
+void InMemoryLabelPropertyIndex::CollectGcCandidates(LabelId label, Vertex *vertex,
+                                                     IndexGcCandidates *candidates) const {
+  for (const auto &[label_property, _] : index_) {
+    if (label_property.first != label) continue;
+    auto value = vertex->properties.GetProperty(label_property.second);
+    if (value.IsNull()) continue;
+    candidates->label_property.emplace_back(label, label_property.second, std::move(value), vertex);
+  }
+}
+
+void InMemoryLabelPropertyIndex::CollectGcCandidates(PropertyId property, const PropertyValue &value, Vertex *vertex,
+                                                     IndexGcCandidates *candidates) const {
+  if (value.IsNull()) return;
+  for (const auto &[label_property, _] : index_) {
+    if (label_property.second != property || !utils::Contains(vertex->labels, label_property.first)) continue;
+    candidates->label_property.emplace_back(label_property.first, property, value, vertex);
+  }
+}
+
+void InMemoryLabelPropertyIndex::RemoveObsoleteEntries(
+    std::vector<std::tuple<LabelId, PropertyId, PropertyValue, Vertex *>> *candidates,
+    uint64_t oldest_active_start_timestamp) {
+  // Group the candidates by index, so every index is accessed once.
+  std::sort(candidates->begin(), candidates->end(), [](const auto &lhs, const auto &rhs) {
+    return std::make_pair(std::get<0>(lhs), std::get<1>(lhs)) < std::make_pair(std::get<0>(rhs), std::get<1>(rhs));
+  });
+
+  auto index_it = index_.end();
+  std::optional<utils::SkipList<Entry>::Accessor> index_acc;
+  for (const auto &[label, property, value, vertex] : *candidates) {
+    const auto label_property = std::make_pair(label, property);
+    if (index_it == index_.end() || index_it->first != label_property) {
+      index_it = index_.find(label_property);
+      if (index_it == index_.end()) continue;
+      index_acc.emplace(index_it->second.access());
+    }
+    for (auto it = index_acc->find_equal_or_greater(Entry{value, vertex, 0});
+         it != index_acc->end() && it->vertex == vertex && it->value == value;) {
+      auto next_it = it;
+      ++next_it;
+
+      if (it->timestamp < oldest_active_start_timestamp &&
+          ((next_it != index_acc->end() && next_it->vertex == vertex && next_it->value == value) ||
+           !AnyVersionHasLabelProperty(*vertex, label, property, value, oldest_active_start_timestamp))) {
+        index_acc->remove(*it);
+      }
+      it = next_it;
+    }
+  }
+}
+
 InMemoryLabelPropertyIndex::Iterable::Iterator::Iterator(Iterable *self,
                                                          utils::SkipList<Entry>::Iterator index_iterator)
     : self_(self),
@@ -11,15 +11,13 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "storage/v2/indices/label_property_index.hpp"
+#include "storage/v2/transaction.hpp"
 
 namespace memgraph::storage {
 
-struct LabelPropertyIndexStats {
-  uint64_t count, distinct_values_count;
-  double statistic, avg_group_size, avg_degree;
-};
-
 /// TODO: andi. Too many copies, extract at one place
 using ParallelizedIndexCreationInfo =
     std::pair<std::vector<std::pair<Gid, uint64_t>> /*vertex_recovery_info*/, uint64_t /*thread_count*/>;
@@ -54,6 +52,18 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
   void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
                            const Transaction &tx) override;
 
+  /// Online index creation, see `InMemoryLabelIndex::RegisterIndex`.
+  bool RegisterIndex(LabelId label, PropertyId property, uint64_t vertex_count);
+
+  /// @throw utils::OutOfMemoryException
+  void PopulateIndex(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices);
+
+  void PublishIndex(LabelId label, PropertyId property);
+
+  void DropPopulatingIndex(LabelId label, PropertyId property);
+
+  std::vector<std::pair<std::pair<LabelId, PropertyId>, double>> ListPopulatingIndices() const override;
+
   bool DropIndex(LabelId label, PropertyId property) override;
 
   bool IndexExists(LabelId label, PropertyId property) const override;
@@ -62,6 +72,19 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
 
   void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
 
+  /// Adds the entries of `vertex` in all indices on `label` to the candidates.
+  void CollectGcCandidates(LabelId label, Vertex *vertex, IndexGcCandidates *candidates) const;
+
+  /// Adds the entries of `vertex` with `value` in all indices on `property`
+  /// to the candidates.
+  void CollectGcCandidates(PropertyId property, const PropertyValue &value, Vertex *vertex,
+                           IndexGcCandidates *candidates) const;
+
+  /// Same as `RemoveObsoleteEntries`, but only checks the entries of the
+  /// given candidates instead of the whole index.
+  void RemoveObsoleteEntries(std::vector<std::tuple<LabelId, PropertyId, PropertyValue, Vertex *>> *candidates,
+                             uint64_t oldest_active_start_timestamp);
+
   class Iterable {
    public:
     Iterable(utils::SkipList<Entry>::Accessor index_accessor, LabelId label, PropertyId property,
@@ -134,7 +157,13 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
                     const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Transaction *transaction);
 
  private:
+  struct PopulationProgress {
+    std::atomic<uint64_t> scanned{0};
+    uint64_t total;
+  };
+
   std::map<std::pair<LabelId, PropertyId>, utils::SkipList<Entry>> index_;
+  std::map<std::pair<LabelId, PropertyId>, PopulationProgress> populating_;
   std::map<std::pair<LabelId, PropertyId>, storage::LabelPropertyIndexStats> stats_;
 };
 
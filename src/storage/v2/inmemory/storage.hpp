@@ -403,13 +403,36 @@ class InMemoryStorage final : public Storage {
   template <bool force>
   void CollectGarbage(std::unique_lock<utils::RWLock> main_guard = {});
 
+  /// Handle used to make the WAL durable up to the given number of written
+  /// transactions.
+  struct WalSyncRequest {
+    utils::FileSyncHandle handle;
+    uint64_t transactions;
+  };
+
   bool InitializeWalFile();
-  void FinalizeWalFile();
+  /// Returns a sync request if the WAL has to be synced after this
+  /// transaction. The sync is executed with `SyncWal` once `engine_lock_` is
+  /// released.
+  [[nodiscard]] std::optional<WalSyncRequest> FinalizeWalFile();
+
+  /// Group commit of WAL syncs. Concurrent requests are batched so that a
+  /// single `fsync` makes all of them durable. Blocks until the data of the
+  /// given request is durable.
+  void SyncWal(WalSyncRequest request);
+
+  /// Syncs the transactions written since the last sync, used to bound the
+  /// time a committed transaction can stay in the WAL without being synced.
+  void SyncWalPeriodically();
 
   StorageInfo GetInfo() const override;
 
   /// Return true in all cases excepted if any sync replicas have not sent confirmation.
-  [[nodiscard]] bool AppendToWalDataManipulation(const Transaction &transaction, uint64_t final_commit_timestamp);
+  /// If `encoded_deltas` is set, they are written to the WAL instead of
+  /// encoding the deltas of the transaction again.
+  [[nodiscard]] bool AppendToWalDataManipulation(const Transaction &transaction, uint64_t final_commit_timestamp,
+                                                 durability::WalDeltasBuffer *encoded_deltas,
+                                                 std::optional<WalSyncRequest> *wal_sync_request);
   /// Return true in all cases excepted if any sync replicas have not sent confirmation.
   [[nodiscard]] bool AppendToWalDataDefinition(durability::StorageGlobalOperation operation, LabelId label,
                                                const std::set<PropertyId> &properties, uint64_t final_commit_timestamp);
@@ -463,6 +486,17 @@ class InMemoryStorage final : public Storage {
 
   std::optional<durability::WalFile> wal_file_;
   uint64_t wal_unsynced_transactions_{0};
+  // Total number of transactions written to the WAL, protected by
+  // `engine_lock_`.
+  uint64_t wal_written_transactions_{0};
+
+  // State of the WAL group commit, see `SyncWal`.
+  std::mutex wal_sync_lock_;
+  std::condition_variable wal_sync_cv_;
+  bool wal_sync_in_progress_{false};
+  uint64_t wal_synced_transactions_{0};
+  std::optional<WalSyncRequest> wal_pending_sync_;
+  utils::Scheduler wal_sync_runner_;
 
   utils::FileRetainer file_retainer_;
 
@@ -479,7 +513,11 @@ class InMemoryStorage final : public Storage {
   std::mutex gc_lock_;
 
   // Undo buffers that were unlinked and now are waiting to be freed.
-  utils::Synchronized<std::list<std::pair<uint64_t, std::list<Delta>>>, utils::SpinLock> garbage_undo_buffers_;
+  utils::Synchronized<std::list<std::pair<uint64_t, DeltaArena>>, utils::SpinLock> garbage_undo_buffers_;
+
+  // Index entries made obsolete by aborted transactions, marked the same way
+  // as undo buffers.
+  utils::Synchronized<std::list<std::pair<uint64_t, IndexGcCandidates>>, utils::SpinLock> garbage_index_gc_candidates_;
 
   // Vertices that are logically deleted but still have to be removed from
   // indices before removing them from the main storage.
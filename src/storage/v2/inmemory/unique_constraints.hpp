@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "storage/v2/constraints/unique_constraints.hpp"
 
 namespace memgraph::storage {
@@ -83,10 +85,24 @@ class InMemoryUniqueConstraints : public UniqueConstraints {
   /// Validates the given vertex against unique constraints before committing.
   /// This method should be called while commit lock is active with
   /// `commit_timestamp` being a potential commit timestamp of the transaction.
+  /// It can also be called before taking the commit lock with
+  /// `kTransactionInitialId` as `commit_timestamp`, which validates the vertex
+  /// against everything committed so far. That result stays valid only while
+  /// `ValidationEpoch` doesn't change.
   /// @throw std::bad_alloc
   std::optional<ConstraintViolation> Validate(const Vertex &vertex, const Transaction &tx,
                                               uint64_t commit_timestamp) const;
 
+  bool HasConstraints() const { return !constraints_.empty(); }
+
+  /// Returns the number of committed transactions which modified vertices
+  /// while there were unique constraints.
+  uint64_t ValidationEpoch() const { return validation_epoch_.load(std::memory_order_acquire); }
+
+  /// Should be called while commit lock is active, after the commit timestamp
+  /// of a transaction which modified vertices was set.
+  void AdvanceValidationEpoch() { validation_epoch_.fetch_add(1, std::memory_order_acq_rel); }
+
   std::vector<std::pair<LabelId, std::set<PropertyId>>> ListConstraints() const override;
 
   /// GC method that removes outdated entries from constraints' storages.
@@ -96,6 +112,7 @@ class InMemoryUniqueConstraints : public UniqueConstraints {
 
  private:
   std::map<std::pair<LabelId, std::set<PropertyId>>, utils::SkipList<Entry>> constraints_;
+  std::atomic<uint64_t> validation_epoch_{0};
 };
 
 }  // namespace memgraph::storage
@@ -11,6 +11,7 @@
 
 #include "storage/v2/property_store.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <iterator>
@@ -20,7 +21,9 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
+#include "storage/v2/property_string_dictionary.hpp"
 #include "storage/v2/temporal.hpp"
 #include "utils/cast.hpp"
 #include "utils/logging.hpp"
@@ -105,7 +108,9 @@ enum class Type : uint8_t {
   STRING = 0x50,
   LIST = 0x60,
   MAP = 0x70,
-  TEMPORAL_DATA = 0x80
+  TEMPORAL_DATA = 0x80,
+  DIRECTORY = 0x90,  // Special value used to indicate the property directory.
+  INTERNED_STRING = 0xa0,
 };
 
 const uint8_t kMaskType = 0xf0;
@@ -167,6 +172,29 @@ const uint8_t kShiftIdSize = 2;
 //         or `uint64_t`
 //       + encoded temporal data type value
 //       + encoded microseconds value
+//   * INTERNED_STRING
+//     - type; payload size is used to indicate whether the ID is encoded as
+//       `uint8_t`, `uint16_t`, `uint32_t` or `uint64_t`
+//     - encoded property ID
+//     - encoded ID of the string in the `PropertyStringDictionary`
+//     Only the values of properties are interned, strings nested in lists and
+//     maps are always encoded as STRING.
+
+// Stores with many properties additionally start with a property directory
+// which makes it possible to find a property without decoding all of the
+// properties that precede it:
+//   * DIRECTORY
+//     - type; id size is used to indicate whether the property IDs in the
+//       directory are encoded as `uint8_t`, `uint16_t`, `uint32_t` or
+//       `uint64_t`; payload size is used in the same way for the offsets
+//     - number of properties encoded as `uint32_t`
+//     - directory entries sorted by property ID, all of the same size
+//       + property ID
+//       + offset of the encoded property, counted from the end of the
+//         directory
+// The properties themselves are encoded after the directory in the same way
+// as when there is no directory. The directory is rebuilt whenever the store
+// is modified.
 
 struct Metadata {
   Type type{Type::EMPTY};
@@ -495,7 +523,8 @@ std::optional<TemporalData> DecodeTemporalData(Reader &reader) {
 // @sa ComparePropertyValue
 [[nodiscard]] bool DecodePropertyValue(Reader *reader, Type type, Size payload_size, PropertyValue *value) {
   switch (type) {
-    case Type::EMPTY: {
+    case Type::EMPTY:
+    case Type::DIRECTORY: {
       return false;
     }
     case Type::NONE: {
@@ -606,6 +635,14 @@ std::optional<TemporalData> DecodeTemporalData(Reader &reader) {
 
       return true;
     }
+    case Type::INTERNED_STRING: {
+      auto id = reader->ReadUint(payload_size);
+      if (!id) return false;
+      if (value) {
+        *value = PropertyValue(PropertyStringDictionary::Global().Get(*id));
+      }
+      return true;
+    }
   }
 }
 
@@ -619,7 +656,8 @@ std::optional<TemporalData> DecodeTemporalData(Reader &reader) {
 // @sa DecodePropertyValue
 [[nodiscard]] bool ComparePropertyValue(Reader *reader, Type type, Size payload_size, const PropertyValue &value) {
   switch (type) {
-    case Type::EMPTY: {
+    case Type::EMPTY:
+    case Type::DIRECTORY: {
       return false;
     }
     case Type::NONE: {
@@ -706,18 +744,33 @@ std::optional<TemporalData> DecodeTemporalData(Reader &reader) {
 
       return *maybe_temporal_data == value.ValueTemporalData();
     }
+    case Type::INTERNED_STRING: {
+      if (!value.IsString()) return false;
+      auto id = reader->ReadUint(payload_size);
+      if (!id) return false;
+      return PropertyStringDictionary::Global().Get(*id) == value.ValueString();
+    }
   }
 }
 
 // Function used to encode a property (PropertyId, PropertyValue) into a byte
-// stream.
-bool EncodeProperty(Writer *writer, PropertyId property, const PropertyValue &value) {
+// stream. When `interned_id` is given, the value is a string which is encoded
+// as that ID of the `PropertyStringDictionary`.
+bool EncodeProperty(Writer *writer, PropertyId property, const PropertyValue &value,
+                    std::optional<uint64_t> interned_id = std::nullopt) {
   auto metadata = writer->WriteMetadata();
   if (!metadata) return false;
 
   auto id_size = writer->WriteUint(property.AsUint());
   if (!id_size) return false;
 
+  if (interned_id) {
+    auto interned_id_size = writer->WriteUint(*interned_id);
+    if (!interned_id_size) return false;
+    metadata->Set({Type::INTERNED_STRING, *id_size, *interned_id_size});
+    return true;
+  }
+
   auto type_property_size = EncodePropertyValue(writer, value);
   if (!type_property_size) return false;
 
@@ -872,6 +925,101 @@ SpecificPropertyAndBufferInfo FindSpecificPropertyAndBufferInfo(Reader *reader,
   return {property_begin, property_end, property_end - property_begin, all_begin, all_end, all_end - all_begin};
 }
 
+// Stores with at least this many properties get a property directory. Below
+// that decoding the properties one by one is cheap enough and the directory
+// would only waste memory.
+const uint64_t kDirectoryMinProperties = 16;
+
+// Size of the directory without its entries.
+const uint64_t kDirectoryHeaderSize = 1 + sizeof(uint32_t);
+
+uint64_t SizeInBytes(Size size) { return uint64_t{1} << utils::UnderlyingCast(size); }
+
+Size FixedSizeFor(uint64_t max_value) {
+  if (max_value <= std::numeric_limits<uint8_t>::max()) return Size::INT8;
+  if (max_value <= std::numeric_limits<uint16_t>::max()) return Size::INT16;
+  if (max_value <= std::numeric_limits<uint32_t>::max()) return Size::INT32;
+  return Size::INT64;
+}
+
+// The values are stored in little-endian, so we can copy just the lower bytes.
+uint64_t ReadFixedUint(const uint8_t *data, Size size) {
+  uint64_t value = 0;
+  memcpy(&value, data, SizeInBytes(size));
+  return value;
+}
+
+void WriteFixedUint(uint8_t *data, uint64_t value, Size size) { memcpy(data, &value, SizeInBytes(size)); }
+
+// View of the property directory at the start of a data buffer.
+struct Directory {
+  const uint8_t *entries;
+  uint64_t count;
+  Size id_size;
+  Size offset_size;
+  // Size of the whole directory, the properties start right after it.
+  uint64_t size;
+
+  uint64_t EntrySize() const { return SizeInBytes(id_size) + SizeInBytes(offset_size); }
+};
+
+std::optional<Directory> ReadDirectory(const uint8_t *data, uint64_t size) {
+  if (size < kDirectoryHeaderSize) return std::nullopt;
+  Reader reader(data, size);
+  auto metadata = reader.ReadMetadata();
+  if (!metadata || metadata->type != Type::DIRECTORY) return std::nullopt;
+  uint32_t count = 0;
+  memcpy(&count, data + 1, sizeof(count));
+  Directory directory{.entries = data + kDirectoryHeaderSize,
+                      .count = count,
+                      .id_size = metadata->id_size,
+                      .offset_size = metadata->payload_size,
+                      .size = 0};
+  directory.size = kDirectoryHeaderSize + directory.count * directory.EntrySize();
+  MG_ASSERT(directory.size <= size, "Invalid property directory!");
+  return directory;
+}
+
+// Returns the offset of the property counted from the end of the directory.
+std::optional<uint64_t> FindPropertyOffset(const Directory &directory, PropertyId property) {
+  const auto entry_size = directory.EntrySize();
+  uint64_t begin = 0;
+  uint64_t end = directory.count;
+  while (begin < end) {
+    const auto middle = begin + (end - begin) / 2;
+    const auto *entry = directory.entries + middle * entry_size;
+    const auto id = ReadFixedUint(entry, directory.id_size);
+    if (id == property.AsUint()) {
+      return ReadFixedUint(entry + SizeInBytes(directory.id_size), directory.offset_size);
+    }
+    if (id < property.AsUint()) {
+      begin = middle + 1;
+    } else {
+      end = middle;
+    }
+  }
+  return std::nullopt;
+}
+
+// Returns a reader positioned at the first encoded property.
+Reader PropertiesReader(const uint8_t *data, uint64_t size) {
+  auto directory = ReadDirectory(data, size);
+  if (!directory) return {data, size};
+  return {data + directory->size, size - directory->size};
+}
+
+// Returns a reader from which `FindSpecificProperty` finds the property. If
+// the buffer has a directory, the reader is positioned directly at the
+// property, or it is empty if the property isn't stored.
+Reader SeekProperty(const uint8_t *data, uint64_t size, PropertyId property) {
+  auto directory = ReadDirectory(data, size);
+  if (!directory) return {data, size};
+  auto offset = FindPropertyOffset(*directory, property);
+  if (!offset) return {nullptr, 0};
+  const auto begin = directory->size + *offset;
+  return {data + begin, size - begin};
+}
+
 // All data buffers will be allocated to a power of 8 size.
 uint64_t ToPowerOf8(uint64_t size) {
   uint64_t mod = size % 8;
@@ -925,6 +1073,111 @@ void SetSizeData(uint8_t *buffer, uint64_t size, uint8_t *data) {
   memcpy(buffer + sizeof(uint64_t), &data, sizeof(uint8_t *));
 }
 
+// Removes the directory from the external buffer, so that the properties can
+// be modified with the functions which expect them at the start of the
+// buffer.
+void RemoveDirectory(uint8_t *buffer) {
+  auto [size, data] = GetSizeData(buffer);
+  // The local buffer never has a directory.
+  if (size % 8 != 0 || size == 0) return;
+  auto directory = ReadDirectory(data, size);
+  if (!directory) return;
+  memmove(data, data + directory->size, size - directory->size);
+  // There is always room for the tombstone because the directory was removed.
+  data[size - directory->size] = static_cast<uint8_t>(Type::EMPTY);
+}
+
+// Puts a directory in front of the properties stored in the external buffer
+// if there are enough of them. The buffer mustn't have a directory already.
+void AddDirectory(uint8_t *buffer) {
+  auto [size, data] = GetSizeData(buffer);
+  if (size % 8 != 0 || size == 0) return;
+
+  uint64_t count = 0;
+  uint64_t max_id = 0;
+  uint64_t properties_size = 0;
+  {
+    Reader reader(data, size);
+    while (true) {
+      auto property = DecodeAnyProperty(&reader, nullptr);
+      if (!property) break;
+      ++count;
+      max_id = std::max(max_id, property->AsUint());
+      properties_size = reader.GetPosition();
+    }
+  }
+  if (count < kDirectoryMinProperties || count > std::numeric_limits<uint32_t>::max()) return;
+
+  const auto id_size = FixedSizeFor(max_id);
+  const auto offset_size = FixedSizeFor(properties_size);
+  const auto entry_size = SizeInBytes(id_size) + SizeInBytes(offset_size);
+  const auto directory_size = kDirectoryHeaderSize + count * entry_size;
+  const auto new_size = directory_size + properties_size;
+
+  if (new_size <= size) {
+    memmove(data + directory_size, data, properties_size);
+  } else {
+    auto new_size_to_power_of_8 = ToPowerOf8(new_size);
+    auto *new_data = new uint8_t[new_size_to_power_of_8];
+    memcpy(new_data + directory_size, data, properties_size);
+    delete[] data;
+    SetSizeData(buffer, new_size_to_power_of_8, new_data);
+    data = new_data;
+    size = new_size_to_power_of_8;
+  }
+
+  Writer writer(data, size);
+  writer.WriteMetadata()->Set({Type::DIRECTORY, id_size, offset_size});
+  const auto count_u32 = static_cast<uint32_t>(count);
+  writer.WriteBytes(reinterpret_cast<const uint8_t *>(&count_u32), sizeof(count_u32));
+
+  auto *entry = data + kDirectoryHeaderSize;
+  Reader reader(data + directory_size, properties_size);
+  while (true) {
+    const auto offset = reader.GetPosition();
+    auto property = DecodeAnyProperty(&reader, nullptr);
+    if (!property) break;
+    WriteFixedUint(entry, property->AsUint(), id_size);
+    WriteFixedUint(entry + SizeInBytes(id_size), offset, offset_size);
+    entry += entry_size;
+  }
+
+  if (new_size < size) data[new_size] = static_cast<uint8_t>(Type::EMPTY);
+}
+
+// Calls `callback` with the dictionary ID of every interned string stored in
+// the buffer.
+template <typename TCallback>
+void ForEachInternedString(const uint8_t *data, uint64_t size, TCallback &&callback) {
+  // Nothing can be interned if the dictionary was never used, which spares
+  // the stores from decoding all of their properties when they are freed.
+  if (!PropertyStringDictionary::Global().WasUsed()) return;
+  auto reader = PropertiesReader(data, size);
+  while (true) {
+    auto metadata = reader.ReadMetadata();
+    if (!metadata) return;
+    if (!reader.ReadUint(metadata->id_size)) return;
+    if (metadata->type == Type::INTERNED_STRING) {
+      auto id = reader.ReadUint(metadata->payload_size);
+      if (!id) return;
+      callback(*id);
+    } else if (!DecodePropertyValue(&reader, metadata->type, metadata->payload_size, nullptr)) {
+      return;
+    }
+  }
+}
+
+// Releases the references held by the interned strings stored in the buffer.
+void ReleaseInternedStrings(const uint8_t *data, uint64_t size) {
+  ForEachInternedString(data, size, [](uint64_t id) { PropertyStringDictionary::Global().Release(id); });
+}
+
+bool HasInternedStrings(const uint8_t *data, uint64_t size) {
+  bool found = false;
+  ForEachInternedString(data, size, [&found](uint64_t /*id*/) { found = true; });
+  return found;
+}
+
 }  // namespace
 
 PropertyStore::PropertyStore() { memset(buffer_, 0, sizeof(buffer_)); }
@@ -940,7 +1193,10 @@ PropertyStore &PropertyStore::operator=(PropertyStore &&other) noexcept {
   std::tie(size, data) = GetSizeData(buffer_);
   if (size % 8 == 0) {
     // We are storing the data in an external buffer.
+    ReleaseInternedStrings(data, size);
     delete[] data;
+  } else {
+    ReleaseInternedStrings(&buffer_[1], sizeof(buffer_) - 1);
   }
 
   memcpy(buffer_, other.buffer_, sizeof(buffer_));
@@ -955,7 +1211,10 @@ PropertyStore::~PropertyStore() {
   std::tie(size, data) = GetSizeData(buffer_);
   if (size % 8 == 0) {
     // We are storing the data in an external buffer.
+    ReleaseInternedStrings(data, size);
     delete[] data;
+  } else {
+    ReleaseInternedStrings(&buffer_[1], sizeof(buffer_) - 1);
   }
 }
 
@@ -968,7 +1227,7 @@ PropertyValue PropertyStore::GetProperty(PropertyId property) const {
     size = sizeof(buffer_) - 1;
     data = &buffer_[1];
   }
-  Reader reader(data, size);
+  auto reader = SeekProperty(data, size, property);
   PropertyValue value;
   if (FindSpecificProperty(&reader, property, &value) != DecodeExpectedPropertyStatus::EQUAL) return PropertyValue();
   return value;
@@ -983,7 +1242,7 @@ bool PropertyStore::HasProperty(PropertyId property) const {
     size = sizeof(buffer_) - 1;
     data = &buffer_[1];
   }
-  Reader reader(data, size);
+  auto reader = SeekProperty(data, size, property);
   return FindSpecificProperty(&reader, property, nullptr) == DecodeExpectedPropertyStatus::EQUAL;
 }
 
@@ -1029,6 +1288,13 @@ bool PropertyStore::IsPropertyEqual(PropertyId property, const PropertyValue &va
     size = sizeof(buffer_) - 1;
     data = &buffer_[1];
   }
+  if (auto directory = ReadDirectory(data, size)) {
+    auto offset = FindPropertyOffset(*directory, property);
+    if (!offset) return value.IsNull();
+    const auto begin = directory->size + *offset;
+    Reader reader(data + begin, size - begin);
+    return CompareExpectedProperty(&reader, property, value);
+  }
   Reader reader(data, size);
   auto info = FindSpecificPropertyAndBufferInfo(&reader, property);
   if (info.property_size == 0) return value.IsNull();
@@ -1046,7 +1312,7 @@ std::map<PropertyId, PropertyValue> PropertyStore::Properties() const {
     size = sizeof(buffer_) - 1;
     data = &buffer_[1];
   }
-  Reader reader(data, size);
+  auto reader = PropertiesReader(data, size);
   std::map<PropertyId, PropertyValue> props;
   while (true) {
     PropertyValue value;
@@ -1058,13 +1324,20 @@ std::map<PropertyId, PropertyValue> PropertyStore::Properties() const {
 }
 
 bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value) {
+  // The reference is acquired before the old value is released, so that
+  // setting the same string again doesn't remove it from the dictionary.
+  std::optional<uint64_t> interned_id;
+  if (value.IsString()) interned_id = PropertyStringDictionary::Global().Acquire(value.ValueString());
+
   uint64_t property_size = 0;
   if (!value.IsNull()) {
     Writer writer;
-    EncodeProperty(&writer, property, value);
+    EncodeProperty(&writer, property, value, interned_id);
     property_size = writer.Written();
   }
 
+  RemoveDirectory(buffer_);
+
   bool in_local_buffer = false;
   uint64_t size;
   uint8_t *data;
@@ -1101,7 +1374,7 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
 
       // Encode the property into the data buffer.
       Writer writer(data, size);
-      MG_ASSERT(EncodeProperty(&writer, property, value), "Invalid database state!");
+      MG_ASSERT(EncodeProperty(&writer, property, value, interned_id), "Invalid database state!");
       auto metadata = writer.WriteMetadata();
       if (metadata) {
         // If there is any space left in the buffer we add a tombstone to
@@ -1116,6 +1389,7 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
     Reader reader(data, size);
     auto info = FindSpecificPropertyAndBufferInfo(&reader, property);
     existed = info.property_size != 0;
+    ReleaseInternedStrings(data + info.property_begin, info.property_size);
     auto new_size = info.all_size - info.property_size + property_size;
     auto new_size_to_power_of_8 = ToPowerOf8(new_size);
     if (new_size_to_power_of_8 == 0) {
@@ -1166,7 +1440,7 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
     if (!value.IsNull()) {
       // We need to encode the new value.
       Writer writer(data + info.property_begin, property_size);
-      MG_ASSERT(EncodeProperty(&writer, property, value), "Invalid database state!");
+      MG_ASSERT(EncodeProperty(&writer, property, value, interned_id), "Invalid database state!");
     }
 
     // We need to recreate the tombstone (if possible).
@@ -1177,11 +1451,13 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
     }
   }
 
+  AddDirectory(buffer_);
+
   return !existed;
 }
 
 template <typename TContainer>
-bool PropertyStore::DoInitProperties(const TContainer &properties) {
+bool PropertyStore::DoInitProperties(const TContainer &properties, bool intern_strings) {
   uint64_t size = 0;
   uint8_t *data = nullptr;
   std::tie(size, data) = GetSizeData(buffer_);
@@ -1189,14 +1465,29 @@ bool PropertyStore::DoInitProperties(const TContainer &properties) {
     return false;
   }
 
+  // IDs of the interned strings, in the same order as the properties.
+  std::vector<std::optional<uint64_t>> interned_ids;
+  auto &dictionary = PropertyStringDictionary::Global();
+  if (intern_strings && dictionary.IsEnabled()) {
+    interned_ids.reserve(properties.size());
+    for (const auto &[property, value] : properties) {
+      interned_ids.emplace_back(value.IsString() ? dictionary.Acquire(value.ValueString()) : std::nullopt);
+    }
+  }
+  auto interned_id = [&interned_ids](uint64_t index) {
+    return interned_ids.empty() ? std::nullopt : interned_ids[index];
+  };
+
   uint64_t property_size = 0;
   {
     Writer writer;
+    uint64_t index = 0;
     for (const auto &[property, value] : properties) {
       if (value.IsNull()) {
+        ++index;
         continue;
       }
-      EncodeProperty(&writer, property, value);
+      EncodeProperty(&writer, property, value, interned_id(index++));
       property_size = writer.Written();
     }
   }
@@ -1221,11 +1512,13 @@ bool PropertyStore::DoInitProperties(const TContainer &properties) {
   // Encode the property into the data buffer.
   Writer writer(data, size);
 
+  uint64_t index = 0;
   for (const auto &[property, value] : properties) {
     if (value.IsNull()) {
+      ++index;
       continue;
     }
-    MG_ASSERT(EncodeProperty(&writer, property, value), "Invalid database state!");
+    MG_ASSERT(EncodeProperty(&writer, property, value, interned_id(index++)), "Invalid database state!");
     writer.Written();
   }
 
@@ -1236,6 +1529,8 @@ bool PropertyStore::DoInitProperties(const TContainer &properties) {
     metadata->Set({Type::EMPTY});
   }
 
+  AddDirectory(buffer_);
+
   return true;
 }
 
@@ -1265,9 +1560,9 @@ std::vector<std::tuple<PropertyId, PropertyValue, PropertyValue>> PropertyStore:
 }
 
 template bool PropertyStore::DoInitProperties<std::map<PropertyId, PropertyValue>>(
-    const std::map<PropertyId, PropertyValue> &);
+    const std::map<PropertyId, PropertyValue> &, bool);
 template bool PropertyStore::DoInitProperties<std::vector<std::pair<PropertyId, PropertyValue>>>(
-    const std::vector<std::pair<PropertyId, PropertyValue>> &);
+    const std::vector<std::pair<PropertyId, PropertyValue>> &, bool);
 
 bool PropertyStore::InitProperties(const std::map<storage::PropertyId, storage::PropertyValue> &properties) {
   return DoInitProperties(properties);
@@ -1291,6 +1586,7 @@ bool PropertyStore::ClearProperties() {
     in_local_buffer = true;
   }
   if (!size) return false;
+  ReleaseInternedStrings(data, size);
   if (!in_local_buffer) delete[] data;
   SetSizeData(buffer_, 0, nullptr);
   return true;
@@ -1304,6 +1600,13 @@ std::string PropertyStore::StringBuffer() const {
     size = sizeof(buffer_) - 1;
     data = &buffer_[1];
   }
+  if (HasInternedStrings(data, size)) {
+    // The dictionary IDs are valid only in this process, so the strings are
+    // encoded inline in a copy of the store instead.
+    PropertyStore store;
+    store.DoInitProperties(Properties(), false);
+    return store.StringBuffer();
+  }
   std::string arr(size, ' ');
   for (uint i = 0; i < size; ++i) {
     arr[i] = static_cast<char>(data[i]);
@@ -41,12 +41,14 @@ class PropertyStore {
 
   /// Returns the currently stored value for property `property`. If the
   /// property doesn't exist a Null value is returned. The time complexity of
-  /// this function is O(n).
+  /// this function is O(n), or O(log(n)) when the store holds enough
+  /// properties to have a property directory.
   /// @throw std::bad_alloc
   PropertyValue GetProperty(PropertyId property) const;
 
   /// Checks whether the property `property` exists in the store. The time
-  /// complexity of this function is O(n).
+  /// complexity of this function is O(n), or O(log(n)) with a property
+  /// directory.
   bool HasProperty(PropertyId property) const;
 
   /// Checks whether all properties in the set `properties` exist in the store. The time
@@ -65,7 +67,7 @@ class PropertyStore {
   /// Checks whether the property `property` is equal to the specified value
   /// `value`. This function doesn't perform any memory allocations while
   /// performing the equality check. The time complexity of this function is
-  /// O(n).
+  /// O(n), or O(log(n)) with a property directory.
   bool IsPropertyEqual(PropertyId property, const PropertyValue &value) const;
 
   /// Returns all properties currently stored in the store. The time complexity
@@ -101,11 +103,13 @@ class PropertyStore {
 
   /// Remove all properties and return `true` if any removal took place.
   /// `false` is returned if there were no properties to remove. The time
-  /// complexity of this function is O(1).
+  /// complexity of this function is O(1), or O(n) once strings were interned
+  /// in the `PropertyStringDictionary`.
   /// @throw std::bad_alloc
   bool ClearProperties();
 
-  /// Return property buffer as a string
+  /// Return property buffer as a string. Interned strings are stored in the
+  /// returned buffer inline, so that it can be used outside of this process.
   std::string StringBuffer() const;
 
   /// Sets buffer
@@ -113,7 +117,7 @@ class PropertyStore {
 
  private:
   template <typename TContainer>
-  bool DoInitProperties(const TContainer &properties);
+  bool DoInitProperties(const TContainer &properties, bool intern_strings = true);
 
   uint8_t buffer_[sizeof(uint64_t) + sizeof(uint8_t *)];
 };
@@ -0,0 +1,93 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/property_string_dictionary.hpp"
+
+#include "utils/logging.hpp"
+
+namespace memgraph::storage {
+
+PropertyStringDictionary &PropertyStringDictionary::Global() {
+  static PropertyStringDictionary dictionary;
+  return dictionary;
+}
+
+PropertyStringDictionary::~PropertyStringDictionary() {
+  for (auto &chunk : chunks_) {
+    delete[] chunk.load(std::memory_order_acquire);
+  }
+}
+
+std::optional<uint64_t> PropertyStringDictionary::Acquire(std::string_view value) {
+  const auto max_length = max_length_.load(std::memory_order_acquire);
+  if (max_length == 0 || value.size() > max_length) return std::nullopt;
+
+  std::lock_guard guard(lock_);
+  if (auto found = ids_.find(value); found != ids_.end()) {
+    const auto id = found->second;
+    chunks_[id / kChunkSize].load(std::memory_order_relaxed)[id % kChunkSize].references.fetch_add(
+        1, std::memory_order_acq_rel);
+    return id;
+  }
+
+  uint64_t id = 0;
+  if (!free_ids_.empty()) {
+    id = free_ids_.back();
+    free_ids_.pop_back();
+  } else {
+    if (next_id_ == kMaxEntries) return std::nullopt;
+    id = next_id_++;
+    auto &chunk = chunks_[id / kChunkSize];
+    if (!chunk.load(std::memory_order_relaxed)) {
+      chunk.store(new Entry[kChunkSize], std::memory_order_release);
+    }
+  }
+  auto &entry = chunks_[id / kChunkSize].load(std::memory_order_relaxed)[id % kChunkSize];
+  entry.value = value;
+  entry.references.store(1, std::memory_order_release);
+  ids_.emplace(entry.value, id);
+  used_.store(true, std::memory_order_release);
+  return id;
+}
+
+void PropertyStringDictionary::Release(uint64_t id) {
+  auto &entry = chunks_[id / kChunkSize].load(std::memory_order_acquire)[id % kChunkSize];
+  const auto references = entry.references.fetch_sub(1, std::memory_order_acq_rel);
+  MG_ASSERT(references > 0, "Releasing an unreferenced interned string!");
+  if (references == 1) released_.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void PropertyStringDictionary::CollectGarbage() {
+  if (released_.exchange(0, std::memory_order_acq_rel) == 0) return;
+
+  std::lock_guard guard(lock_);
+  // References are only acquired under the lock, so an entry which has no
+  // references now can't get one before it is removed.
+  for (auto it = ids_.begin(); it != ids_.end();) {
+    const auto id = it->second;
+    auto &entry = chunks_[id / kChunkSize].load(std::memory_order_relaxed)[id % kChunkSize];
+    if (entry.references.load(std::memory_order_acquire) != 0) {
+      ++it;
+      continue;
+    }
+    it = ids_.erase(it);
+    entry.value.clear();
+    entry.value.shrink_to_fit();
+    free_ids_.push_back(id);
+  }
+}
+
+uint64_t PropertyStringDictionary::Size() const {
+  std::lock_guard guard(lock_);
+  return ids_.size();
+}
+
+}  // namespace memgraph::storage
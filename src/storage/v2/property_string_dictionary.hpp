@@ -0,0 +1,123 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace memgraph::storage {
+
+/// Process-wide dictionary of short string property values.
+///
+/// Low-cardinality string properties (e.g. `country` or `status`) repeat the
+/// same few values in the properties of millions of vertices. When interning
+/// is enabled, `PropertyStore` stores such values as a small ID into this
+/// dictionary instead of storing the whole string in every buffer.
+///
+/// Every `PropertyStore` that contains an ID holds a reference to it. Entries
+/// whose reference count dropped to zero are removed by `CollectGarbage`,
+/// which is called by the storage GC, and their IDs are reused afterwards.
+/// The disk storage has no GC thread and calls it only on FREE MEMORY, so
+/// with it alone released entries stay in the dictionary until then.
+///
+/// Reading an entry by its ID doesn't take any locks. It is safe because the
+/// caller holds a reference, so the entry can't be removed while it is read.
+class PropertyStringDictionary final {
+ public:
+  /// Largest number of entries. Strings which don't fit anymore are stored
+  /// inline, which keeps the dictionary small when the interned property
+  /// turns out to have a high cardinality.
+  static constexpr uint64_t kMaxEntries = uint64_t{1} << 20;
+
+  /// Returns the dictionary used by all property stores.
+  static PropertyStringDictionary &Global();
+
+  PropertyStringDictionary() = default;
+  PropertyStringDictionary(const PropertyStringDictionary &) = delete;
+  PropertyStringDictionary &operator=(const PropertyStringDictionary &) = delete;
+  PropertyStringDictionary(PropertyStringDictionary &&) = delete;
+  PropertyStringDictionary &operator=(PropertyStringDictionary &&) = delete;
+  ~PropertyStringDictionary();
+
+  /// Strings of up to `max_length` bytes are interned. Zero, which is the
+  /// default, disables interning.
+  void SetMaxLength(uint64_t max_length) { max_length_.store(max_length, std::memory_order_release); }
+
+  uint64_t MaxLength() const { return max_length_.load(std::memory_order_acquire); }
+
+  bool IsEnabled() const { return max_length_.load(std::memory_order_acquire) != 0; }
+
+  /// Returns the ID of the string and acquires a reference to it, or
+  /// `std::nullopt` if the string shouldn't be interned.
+  /// @throw std::bad_alloc
+  std::optional<uint64_t> Acquire(std::string_view value);
+
+  /// Releases a reference acquired with `Acquire`.
+  void Release(uint64_t id);
+
+  /// Returns the string with the given ID. The caller must hold a reference
+  /// to the ID.
+  const std::string &Get(uint64_t id) const {
+    return chunks_[id / kChunkSize].load(std::memory_order_acquire)[id % kChunkSize].value;
+  }
+
+  /// Returns `true` if any string was ever interned, so that stores can skip
+  /// looking for IDs to release when interning was never used.
+  bool WasUsed() const { return used_.load(std::memory_order_acquire); }
+
+  /// Removes the entries which aren't referenced anymore.
+  void CollectGarbage();
+
+  /// Returns the number of entries, including the unreferenced ones which
+  /// weren't collected yet.
+  uint64_t Size() const;
+
+ private:
+  static constexpr uint64_t kChunkSize = 4096;
+
+  struct Entry {
+    std::string value;
+    std::atomic<uint64_t> references{0};
+  };
+
+  struct StringHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view value) const { return std::hash<std::string_view>{}(value); }
+  };
+
+  std::atomic<uint64_t> max_length_{0};
+  std::atomic<bool> used_{false};
+  // Number of entries whose reference count dropped to zero since the last
+  // garbage collection.
+  std::atomic<uint64_t> released_{0};
+
+  // Entries are allocated in chunks which never move, so that they can be
+  // read without taking the lock.
+  std::array<std::atomic<Entry *>, kMaxEntries / kChunkSize> chunks_{};
+
+  // Everything below is protected by the lock.
+  mutable std::mutex lock_;
+  std::unordered_map<std::string, uint64_t, StringHash, std::equal_to<>> ids_;
+  std::vector<uint64_t> free_ids_;
+  uint64_t next_id_{0};
+};
+
+}  // namespace memgraph::storage
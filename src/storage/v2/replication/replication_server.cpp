@@ -11,6 +11,9 @@
 
 #include <atomic>
 #include <filesystem>
+#include <future>
+#include <memory>
+#include <vector>
 
 #include "spdlog/spdlog.h"
 
@@ -27,6 +30,7 @@
 #include "storage/v2/replication/replication_server.hpp"
 #include "storage/v2/transaction.hpp"
 #include "utils/exceptions.hpp"
+#include "utils/on_scope_exit.hpp"
 
 namespace memgraph::storage {
 namespace {
@@ -42,6 +46,10 @@ std::pair<uint64_t, durability::WalDeltaData> ReadDelta(durability::BaseDecoder
     throw utils::BasicException("Invalid data!");
   }
 };
+
+// Number of deltas that are decoded before they are handed over to the apply
+// thread.
+constexpr size_t kDeltaApplyBatchSize = 1024;
 }  // namespace
 
 InMemoryStorage::ReplicationServer::ReplicationServer(InMemoryStorage *storage, io::network::Endpoint endpoint,
@@ -120,18 +128,22 @@ void InMemoryStorage::ReplicationServer::AppendDeltasHandler(slk::Reader *req_re
     storage_->epoch_id_ = std::move(*maybe_epoch_id);
   }
 
-  if (storage_->wal_file_) {
-    if (req.seq_num > storage_->wal_file_->SequenceNumber() || *maybe_epoch_id != storage_->epoch_id_) {
-      storage_->wal_file_->FinalizeWal();
-      storage_->wal_file_.reset();
-      storage_->wal_seq_num_ = req.seq_num;
-      spdlog::trace("Finalized WAL file");
+  {
+    // The WAL file is also synced periodically while holding the engine lock.
+    std::lock_guard<utils::SpinLock> engine_guard(storage_->engine_lock_);
+    if (storage_->wal_file_) {
+      if (req.seq_num > storage_->wal_file_->SequenceNumber() || *maybe_epoch_id != storage_->epoch_id_) {
+        storage_->wal_file_->FinalizeWal();
+        storage_->wal_file_.reset();
+        storage_->wal_seq_num_ = req.seq_num;
+        spdlog::trace("Finalized WAL file");
+      } else {
+        MG_ASSERT(storage_->wal_file_->SequenceNumber() == req.seq_num, "Invalid sequence number of current wal file");
+        storage_->wal_seq_num_ = req.seq_num + 1;
+      }
     } else {
-      MG_ASSERT(storage_->wal_file_->SequenceNumber() == req.seq_num, "Invalid sequence number of current wal file");
-      storage_->wal_seq_num_ = req.seq_num + 1;
+      storage_->wal_seq_num_ = req.seq_num;
     }
-  } else {
-    storage_->wal_seq_num_ = req.seq_num;
   }
 
   if (req.previous_commit_timestamp != storage_->last_commit_timestamp_.load()) {
@@ -223,6 +235,7 @@ void InMemoryStorage::ReplicationServer::SnapshotHandler(slk::Reader *req_reader
       storage_->file_retainer_.DeleteFile(wal_file.path);
     }
 
+    std::lock_guard<utils::SpinLock> engine_guard(storage_->engine_lock_);
     storage_->wal_file_.reset();
   }
   spdlog::debug("Replication recovery from snapshot finished!");
@@ -280,15 +293,18 @@ void InMemoryStorage::ReplicationServer::LoadWal(replication::Decoder *decoder)
       storage_->epoch_id_ = std::move(wal_info.epoch_id);
     }
 
-    if (storage_->wal_file_) {
-      if (storage_->wal_file_->SequenceNumber() != wal_info.seq_num) {
-        storage_->wal_file_->FinalizeWal();
+    {
+      std::lock_guard<utils::SpinLock> engine_guard(storage_->engine_lock_);
+      if (storage_->wal_file_) {
+        if (storage_->wal_file_->SequenceNumber() != wal_info.seq_num) {
+          storage_->wal_file_->FinalizeWal();
+          storage_->wal_seq_num_ = wal_info.seq_num;
+          storage_->wal_file_.reset();
+          spdlog::trace("WAL file {} finalized successfully", *maybe_wal_path);
+        }
+      } else {
         storage_->wal_seq_num_ = wal_info.seq_num;
-        storage_->wal_file_.reset();
-        spdlog::trace("WAL file {} finalized successfully", *maybe_wal_path);
       }
-    } else {
-      storage_->wal_seq_num_ = wal_info.seq_num;
     }
     spdlog::trace("Loading WAL deltas from {}", *maybe_wal_path);
     durability::Decoder wal;
@@ -342,22 +358,15 @@ uint64_t InMemoryStorage::ReplicationServer::ReadAndApplyDelta(durability::BaseD
     throw utils::BasicException("Received transaction for not supported storage!");
   };
 
-  uint64_t applied_deltas = 0;
-  auto max_commit_timestamp = storage_->last_commit_timestamp_.load();
-
-  for (bool transaction_complete = false; !transaction_complete; ++applied_deltas) {
-    const auto [timestamp, delta] = ReadDelta(decoder);
-    if (timestamp > max_commit_timestamp) {
-      max_commit_timestamp = timestamp;
-    }
-
-    transaction_complete = durability::IsWalDeltaDataTypeTransactionEnd(delta.type);
-
+  // Deltas are decoded on this thread and applied on the apply thread in
+  // batches, so that decoding a batch overlaps with applying the previous one.
+  // All deltas are applied by the same thread and in the order in which they
+  // were received, because they belong to the same storage transaction.
+  auto apply_delta = [&](uint64_t timestamp, const durability::WalDeltaData &delta) {
     if (timestamp < storage_->timestamp_) {
-      continue;
+      return;
     }
 
-    SPDLOG_INFO("  Delta {}", applied_deltas);
     switch (delta.type) {
       case durability::WalDeltaData::Type::VERTEX_CREATE: {
         spdlog::trace("       Create vertex {}", delta.vertex_create_delete.gid.AsUint());
@@ -606,7 +615,50 @@ uint64_t InMemoryStorage::ReplicationServer::ReadAndApplyDelta(durability::BaseD
         break;
       }
     }
+  };
+
+  std::future<void> applying;
+  // The batch that is being applied uses the state above, so it has to be
+  // finished before the state is destroyed, even if decoding fails. The
+  // accessor of an unfinished transaction holds the storage lock, which has to
+  // be released by the apply thread that acquired it.
+  utils::OnScopeExit wait_for_apply{[&] {
+    if (applying.valid()) applying.wait();
+    if (!commit_timestamp_and_accessor) return;
+    std::packaged_task<void()> release([&commit_timestamp_and_accessor] { commit_timestamp_and_accessor.reset(); });
+    auto released = release.get_future();
+    apply_pool_.AddTask([&release] { release(); });
+    released.wait();
+  }};
+
+  uint64_t applied_deltas = 0;
+  auto max_commit_timestamp = storage_->last_commit_timestamp_.load();
+
+  for (bool transaction_complete = false; !transaction_complete;) {
+    std::vector<std::pair<uint64_t, durability::WalDeltaData>> batch;
+    batch.reserve(kDeltaApplyBatchSize);
+    while (!transaction_complete && batch.size() < kDeltaApplyBatchSize) {
+      auto [timestamp, delta] = ReadDelta(decoder);
+      if (timestamp > max_commit_timestamp) {
+        max_commit_timestamp = timestamp;
+      }
+      transaction_complete = durability::IsWalDeltaDataTypeTransactionEnd(delta.type);
+      batch.emplace_back(timestamp, std::move(delta));
+    }
+    applied_deltas += batch.size();
+
+    // Waiting for the previous batch bounds the number of decoded deltas that
+    // are kept in memory and rethrows the error if applying it failed.
+    if (applying.valid()) applying.get();
+    auto task = std::make_shared<std::packaged_task<void()>>([&apply_delta, batch = std::move(batch)] {
+      for (const auto &[timestamp, delta] : batch) {
+        apply_delta(timestamp, delta);
+      }
+    });
+    applying = task->get_future();
+    apply_pool_.AddTask([task] { (*task)(); });
   }
+  applying.get();
 
   if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid data!");
 
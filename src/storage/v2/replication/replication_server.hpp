@@ -15,6 +15,7 @@
 #include "slk/streams.hpp"
 #include "storage/v2/inmemory/storage.hpp"
 #include "storage/v2/replication/replication_client.hpp"
+#include "utils/thread_pool.hpp"
 
 namespace memgraph::storage {
 
@@ -42,6 +43,10 @@ class InMemoryStorage::ReplicationServer {
   void LoadWal(replication::Decoder *decoder);
   uint64_t ReadAndApplyDelta(durability::BaseDecoder *decoder);
 
+  // Applies the deltas decoded by the RPC handlers. It is declared before the
+  // RPC server so it outlives the handlers that use it.
+  utils::ThreadPool apply_pool_{1};
+
   std::optional<communication::ServerContext> rpc_server_context_;
   std::optional<rpc::Server> rpc_server_;
 
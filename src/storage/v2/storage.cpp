@@ -77,7 +77,8 @@ Storage::Accessor::Accessor(Accessor &&other) noexcept
 
 IndicesInfo Storage::ListAllIndices() const {
   std::shared_lock<utils::RWLock> storage_guard_(main_lock_);
-  return {indices_.label_index_->ListIndices(), indices_.label_property_index_->ListIndices()};
+  return {indices_.label_index_->ListIndices(), indices_.label_property_index_->ListIndices(),
+          indices_.label_index_->ListPopulatingIndices(), indices_.label_property_index_->ListPopulatingIndices()};
 }
 
 ConstraintsInfo Storage::ListAllConstraints() const {
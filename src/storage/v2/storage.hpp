@@ -28,13 +28,29 @@
 #include "storage/v2/storage_mode.hpp"
 #include "storage/v2/vertices_iterable.hpp"
 #include "utils/event_counter.hpp"
+#include "utils/event_gauge.hpp"
 #include "utils/event_histogram.hpp"
 #include "utils/scheduler.hpp"
 #include "utils/timer.hpp"
 #include "utils/uuid.hpp"
 
 namespace memgraph::metrics {
+extern const Event CommitLatency_us;
+extern const Event CommitLockWaitLatency_ns;
 extern const Event SnapshotCreationLatency_us;
+extern const Event SnapshotCreationThroughput;
+extern const Event WalEncodeLatency_us;
+extern const Event WalFlushLatency_us;
+extern const Event WalSyncLatency_us;
+extern const Event WalSyncBatchSize;
+extern const Event GCLatency_us;
+extern const Event GCUnlinkLatency_us;
+extern const Event GCIndexCleanupLatency_us;
+extern const Event GCFreeLatency_us;
+extern const Event IndexCreationLatency_us;
+
+extern const Event GCPendingUndoBuffers;
+extern const Event GCPendingVertices;
 
 extern const Event ActiveLabelIndices;
 extern const Event ActiveLabelPropertyIndices;
@@ -48,6 +64,9 @@ class EdgeAccessor;
 struct IndicesInfo {
   std::vector<LabelId> label;
   std::vector<std::pair<LabelId, PropertyId>> label_property;
+  // Indices which are still being built, with the fraction of the build done.
+  std::vector<std::pair<LabelId, double>> label_populating;
+  std::vector<std::pair<std::pair<LabelId, PropertyId>, double>> label_property_populating;
 };
 
 struct ConstraintsInfo {
@@ -165,6 +184,10 @@ class Storage {
 
     std::optional<uint64_t> GetTransactionId() const;
 
+    /// Returns the number of times `AdvanceCommand` was called in the
+    /// transaction.
+    uint64_t GetCommandId() const { return transaction_.command_id; }
+
     void AdvanceCommand();
 
     const std::string &LabelToName(LabelId label) const { return storage_->LabelToName(label); }
@@ -15,10 +15,14 @@
 #include <limits>
 #include <list>
 #include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include "utils/skip_list.hpp"
 
 #include "storage/v2/delta.hpp"
+#include "storage/v2/delta_arena.hpp"
 #include "storage/v2/edge.hpp"
 #include "storage/v2/isolation_level.hpp"
 #include "storage/v2/property_value.hpp"
@@ -32,6 +36,22 @@ namespace memgraph::storage {
 const uint64_t kTimestampInitialId = 0;
 const uint64_t kTransactionInitialId = 1ULL << 63U;
 
+/// Index entries which might have become obsolete because of a transaction.
+/// Writes record the entries they could have invalidated, so the garbage
+/// collector only has to check these entries instead of whole indices.
+struct IndexGcCandidates {
+  std::vector<std::pair<LabelId, Vertex *>> label;
+  std::vector<std::tuple<LabelId, PropertyId, PropertyValue, Vertex *>> label_property;
+
+  bool empty() const { return label.empty() && label_property.empty(); }
+
+  void Append(IndexGcCandidates &&other) {
+    label.insert(label.end(), other.label.begin(), other.label.end());
+    label_property.insert(label_property.end(), std::make_move_iterator(other.label_property.begin()),
+                          std::make_move_iterator(other.label_property.end()));
+  }
+};
+
 struct Transaction {
   Transaction(uint64_t transaction_id, uint64_t start_timestamp, IsolationLevel isolation_level,
               StorageMode storage_mode)
@@ -48,6 +68,7 @@ struct Transaction {
         commit_timestamp(std::move(other.commit_timestamp)),
         command_id(other.command_id),
         deltas(std::move(other.deltas)),
+        index_gc_candidates(std::move(other.index_gc_candidates)),
         must_abort(other.must_abort),
         isolation_level(other.isolation_level),
         storage_mode(other.storage_mode),
@@ -73,7 +94,8 @@ struct Transaction {
   // `commited_transactions_` list for GC.
   std::unique_ptr<std::atomic<uint64_t>> commit_timestamp;
   uint64_t command_id;
-  std::list<Delta> deltas;
+  DeltaArena deltas;
+  IndexGcCandidates index_gc_candidates;
   bool must_abort;
   IsolationLevel isolation_level;
   StorageMode storage_mode;
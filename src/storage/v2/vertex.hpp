@@ -12,13 +12,13 @@
 #pragma once
 
 #include <limits>
-#include <tuple>
 #include <vector>
 
 #include "storage/v2/delta.hpp"
 #include "storage/v2/edge_ref.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_store.hpp"
+#include "storage/v2/vertex_edges.hpp"
 #include "utils/spin_lock.hpp"
 
 namespace memgraph::storage {
@@ -35,8 +35,8 @@ struct Vertex {
   std::vector<LabelId> labels;
   PropertyStore properties;
 
-  std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> in_edges;
-  std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> out_edges;
+  VertexEdges in_edges;
+  VertexEdges out_edges;
 
   mutable utils::SpinLock lock;
   bool deleted;
@@ -47,6 +47,7 @@ struct Vertex {
 };
 
 static_assert(alignof(Vertex) >= 8, "The Vertex should be aligned to at least 8!");
+static_assert(sizeof(Vertex) <= 80, "The Vertex should take at most 80 bytes!");
 
 inline bool operator==(const Vertex &first, const Vertex &second) { return first.gid == second.gid; }
 inline bool operator<(const Vertex &first, const Vertex &second) { return first.gid < second.gid; }
@@ -11,6 +11,7 @@
 
 #include "storage/v2/vertex_accessor.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <tuple>
 #include <utility>
@@ -29,6 +30,43 @@
 
 namespace memgraph::storage {
 
+namespace {
+
+// Copies the edges which pass the filters into `result`. When edge types are
+// given, only the edges of those types are visited.
+void CollectEdges(const VertexEdges &edges, const std::vector<EdgeTypeId> &edge_types, const Vertex *destination,
+                  std::vector<VertexEdges::value_type> *result) {
+  if (edge_types.empty()) {
+    if (!destination) {
+      result->assign(edges.begin(), edges.end());
+      return;
+    }
+    for (const auto &[edge_type, vertex, edge] : edges) {
+      if (vertex != destination) continue;
+      result->emplace_back(edge_type, vertex, edge);
+    }
+    return;
+  }
+  for (auto it = edge_types.begin(); it != edge_types.end(); ++it) {
+    // The same edges mustn't be returned twice if a type is repeated.
+    if (std::find(edge_types.begin(), it, *it) != it) continue;
+    for (const auto &[vertex, edge] : edges.EdgesOfType(*it)) {
+      if (destination && vertex != destination) continue;
+      result->emplace_back(*it, vertex, edge);
+    }
+  }
+}
+
+// The in-memory garbage collector only checks the index entries recorded by
+// the transactions instead of sweeping the whole indices. Analytical
+// transactions don't record anything because they are followed by a full
+// sweep, and disk indices aren't garbage collected.
+bool RecordsIndexGcCandidates(const Transaction *transaction) {
+  return transaction->storage_mode == StorageMode::IN_MEMORY_TRANSACTIONAL;
+}
+
+}  // namespace
+
 namespace detail {
 std::pair<bool, bool> IsVisible(Vertex const *vertex, Transaction const *transaction, View view) {
   bool exists = true;
@@ -117,6 +155,9 @@ Result<bool> VertexAccessor::RemoveLabel(LabelId label) {
   auto it = std::find(vertex_->labels.begin(), vertex_->labels.end(), label);
   if (it == vertex_->labels.end()) return false;
 
+  if (RecordsIndexGcCandidates(transaction_)) {
+    indices_->CollectGcCandidatesOnRemoveLabel(label, vertex_, &transaction_->index_gc_candidates);
+  }
   CreateAndLinkDelta(transaction_, vertex_, Delta::AddLabelTag(), label);
   *it = vertex_->labels.back();
   vertex_->labels.pop_back();
@@ -239,6 +280,9 @@ Result<PropertyValue> VertexAccessor::SetProperty(PropertyId property, const Pro
   // "modify in-place". Additionally, the created delta will make other
   // transactions get a SERIALIZATION_ERROR.
 
+  if (RecordsIndexGcCandidates(transaction_)) {
+    indices_->CollectGcCandidatesOnSetProperty(property, current_value, vertex_, &transaction_->index_gc_candidates);
+  }
   CreateAndLinkDelta(transaction_, vertex_, Delta::SetPropertyTag(), property, current_value);
   vertex_->properties.SetProperty(property, value);
 
@@ -278,6 +322,9 @@ Result<std::vector<std::tuple<PropertyId, PropertyValue, PropertyValue>>> Vertex
   auto id_old_new_change = vertex_->properties.UpdateProperties(properties);
 
   for (auto &[id, old_value, new_value] : id_old_new_change) {
+    if (RecordsIndexGcCandidates(transaction_)) {
+      indices_->CollectGcCandidatesOnSetProperty(id, old_value, vertex_, &transaction_->index_gc_candidates);
+    }
     indices_->UpdateOnSetProperty(id, new_value, vertex_, *transaction_);
     CreateAndLinkDelta(transaction_, vertex_, Delta::SetPropertyTag(), id, std::move(old_value));
     transaction_->manyDeltasCache.Invalidate(vertex_, id);
@@ -295,6 +342,9 @@ Result<std::map<PropertyId, PropertyValue>> VertexAccessor::ClearProperties() {
 
   auto properties = vertex_->properties.Properties();
   for (const auto &[property, value] : properties) {
+    if (RecordsIndexGcCandidates(transaction_)) {
+      indices_->CollectGcCandidatesOnSetProperty(property, value, vertex_, &transaction_->index_gc_candidates);
+    }
     CreateAndLinkDelta(transaction_, vertex_, Delta::SetPropertyTag(), property, value);
     indices_->UpdateOnSetProperty(property, PropertyValue(), vertex_, *transaction_);
     transaction_->manyDeltasCache.Invalidate(vertex_, property);
@@ -405,7 +455,7 @@ Result<std::vector<EdgeAccessor>> VertexAccessor::InEdges(View view, const std::
                                                           const VertexAccessor *destination) const {
   MG_ASSERT(!destination || destination->transaction_ == transaction_, "Invalid accessor!");
 
-  using edge_store = std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>>;
+  using edge_store = std::vector<VertexEdges::value_type>;
 
   // We return EdgeAccessors, this method with wrap the results in EdgeAccessors
   auto const build_result = [this](edge_store const &edges) -> std::vector<EdgeAccessor> {
@@ -426,17 +476,7 @@ Result<std::vector<EdgeAccessor>> VertexAccessor::InEdges(View view, const std::
   {
     std::lock_guard<utils::SpinLock> guard(vertex_->lock);
     deleted = vertex_->deleted;
-    // TODO: a better filter copy
-    if (edge_types.empty() && !destination) {
-      in_edges = vertex_->in_edges;
-    } else {
-      for (const auto &[edge_type, from_vertex, edge] : vertex_->in_edges) {
-        if (destination && from_vertex != destination_vertex) continue;
-        if (!edge_types.empty() && std::find(edge_types.begin(), edge_types.end(), edge_type) == edge_types.end())
-          continue;
-        in_edges.emplace_back(edge_type, from_vertex, edge);
-      }
-    }
+    CollectEdges(vertex_->in_edges, edge_types, destination_vertex, &in_edges);
     delta = vertex_->delta;
   }
 
@@ -482,7 +522,7 @@ Result<std::vector<EdgeAccessor>> VertexAccessor::OutEdges(View view, const std:
                                                            const VertexAccessor *destination) const {
   MG_ASSERT(!destination || destination->transaction_ == transaction_, "Invalid accessor!");
 
-  using edge_store = std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>>;
+  using edge_store = std::vector<VertexEdges::value_type>;
 
   auto const build_result = [this](edge_store const &out_edges) {
     auto ret = std::vector<EdgeAccessor>{};
@@ -502,16 +542,7 @@ Result<std::vector<EdgeAccessor>> VertexAccessor::OutEdges(View view, const std:
   {
     std::lock_guard<utils::SpinLock> guard(vertex_->lock);
     deleted = vertex_->deleted;
-    if (edge_types.empty() && !destination) {
-      out_edges = vertex_->out_edges;
-    } else {
-      for (const auto &[edge_type, to_vertex, edge] : vertex_->out_edges) {
-        if (destination && to_vertex != dst_vertex) continue;
-        if (!edge_types.empty() && std::find(edge_types.begin(), edge_types.end(), edge_type) == edge_types.end())
-          continue;
-        out_edges.emplace_back(edge_type, to_vertex, edge);
-      }
-    }
+    CollectEdges(vertex_->out_edges, edge_types, dst_vertex, &out_edges);
     delta = vertex_->delta;
   }
 
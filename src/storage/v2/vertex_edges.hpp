@@ -0,0 +1,272 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <span>
+#include <tuple>
+#include <utility>
+
+#include "storage/v2/edge_ref.hpp"
+#include "storage/v2/id_types.hpp"
+#include "utils/logging.hpp"
+
+namespace memgraph::storage {
+
+// Forward declaration because we only store a pointer here.
+struct Vertex;
+
+/// Adjacency list of a vertex in one direction, grouped by edge type.
+///
+/// The edges are kept in a single packed array in which all edges of the same
+/// type are stored next to each other. A small header maps each edge type
+/// that is present to the start of its range, so all edges of a given type
+/// can be found without scanning the edges of other types. The edge type is
+/// only stored once per range, which makes an edge take 16 bytes instead of
+/// the 24 bytes of a `std::tuple<EdgeTypeId, Vertex *, EdgeRef>`.
+///
+/// The sizes, the group headers and the edges are all stored in one heap
+/// block, so the container itself is a single pointer and an empty list
+/// doesn't allocate.
+///
+/// The order of the edges within a type isn't preserved when edges are
+/// added or removed.
+class VertexEdges final {
+ public:
+  struct Entry {
+    Vertex *vertex;
+    EdgeRef edge;
+  };
+
+  using value_type = std::tuple<EdgeTypeId, Vertex *, EdgeRef>;
+
+  /// Iterates over all edges as `(edge type, vertex, edge)` tuples.
+  class Iterator final {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::forward_iterator_tag;
+    using value_type = VertexEdges::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = value_type;
+
+    Iterator() = default;
+
+    value_type operator*() const {
+      const auto &entry = self_->Entries()[pos_];
+      return {self_->Groups()[group_].type, entry.vertex, entry.edge};
+    }
+
+    Iterator &operator++() {
+      ++pos_;
+      while (group_ < self_->NumGroups() && pos_ == self_->GroupEnd(group_)) ++group_;
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto old = *this;
+      ++*this;
+      return old;
+    }
+
+    bool operator==(const Iterator &other) const { return pos_ == other.pos_; }
+
+   private:
+    friend class VertexEdges;
+
+    Iterator(const VertexEdges *self, size_t group, size_t pos) : self_(self), group_(group), pos_(pos) {}
+
+    const VertexEdges *self_{nullptr};
+    size_t group_{0};
+    size_t pos_{0};
+  };
+
+  VertexEdges() = default;
+
+  VertexEdges(const VertexEdges &other) {
+    if (other.empty()) return;
+    Reallocate(other.NumGroups(), other.size());
+    std::copy_n(other.Groups(), other.NumGroups(), Groups());
+    std::copy_n(other.Entries(), other.size(), Entries());
+    data_->num_groups = other.data_->num_groups;
+    data_->size = other.data_->size;
+  }
+
+  VertexEdges(VertexEdges &&other) noexcept : data_(std::exchange(other.data_, nullptr)) {}
+
+  VertexEdges &operator=(const VertexEdges &other) {
+    if (this != &other) VertexEdges(other).swap(*this);
+    return *this;
+  }
+
+  VertexEdges &operator=(VertexEdges &&other) noexcept {
+    VertexEdges(std::move(other)).swap(*this);
+    return *this;
+  }
+
+  ~VertexEdges() { ::operator delete(data_); }
+
+  void swap(VertexEdges &other) noexcept { std::swap(data_, other.data_); }
+
+  bool empty() const { return size() == 0; }
+  size_t size() const { return data_ ? data_->size : 0; }
+
+  /// @throw std::bad_alloc
+  void reserve(size_t size) {
+    if (size > Capacity()) Reallocate(GroupCapacity(), size);
+  }
+
+  Iterator begin() const { return {this, 0, 0}; }
+  Iterator end() const { return {this, NumGroups(), size()}; }
+
+  /// Returns all edges of the given type.
+  std::span<const Entry> EdgesOfType(EdgeTypeId edge_type) const {
+    auto group = FindGroup(edge_type);
+    if (group == NumGroups() || Groups()[group].type != edge_type) return {};
+    return {Entries() + Groups()[group].begin, Entries() + GroupEnd(group)};
+  }
+
+  /// @throw std::bad_alloc
+  void Add(EdgeTypeId edge_type, Vertex *vertex, EdgeRef edge) {
+    auto group = FindGroup(edge_type);
+    const auto num_groups = NumGroups();
+    const bool new_group = group == num_groups || Groups()[group].type != edge_type;
+    if (num_groups + new_group > GroupCapacity() || size() + 1 > Capacity()) {
+      Reallocate(Grown(GroupCapacity(), num_groups + new_group), Grown(Capacity(), size() + 1));
+    }
+    auto *groups = Groups();
+    auto *entries = Entries();
+    if (new_group) {
+      const auto begin = group == num_groups ? data_->size : groups[group].begin;
+      std::copy_backward(groups + group, groups + num_groups, groups + num_groups + 1);
+      groups[group] = Group{.type = edge_type, .begin = begin};
+      ++data_->num_groups;
+    }
+    // The new slot at the back is shifted to the end of the group by moving
+    // the first edge of every following group to the end of that group.
+    auto hole = data_->size++;
+    for (auto i = NumGroups() - 1; i > group; --i) {
+      auto &following = groups[i];
+      entries[hole] = entries[following.begin];
+      hole = following.begin;
+      ++following.begin;
+    }
+    entries[hole] = {vertex, edge};
+  }
+
+  /// Removes the edge and returns `true` if it was found.
+  bool Remove(EdgeTypeId edge_type, Vertex *vertex, EdgeRef edge) {
+    auto group = FindGroup(edge_type);
+    if (group == NumGroups() || Groups()[group].type != edge_type) return false;
+    auto *groups = Groups();
+    auto *entries = Entries();
+    auto *first = entries + groups[group].begin;
+    auto *last = entries + GroupEnd(group);
+    auto *found =
+        std::find_if(first, last, [&](const auto &entry) { return entry.vertex == vertex && entry.edge == edge; });
+    if (found == last) return false;
+    // The last edge of the group fills the removed slot, and the hole at the
+    // end of the group is moved to the back by moving the last edge of every
+    // following group to the front of that group.
+    *found = *(last - 1);
+    auto hole = GroupEnd(group) - 1;
+    for (auto i = group + 1; i < NumGroups(); ++i) {
+      auto &following = groups[i];
+      const auto following_last = GroupEnd(i) - 1;
+      entries[hole] = entries[following_last];
+      hole = following_last;
+      --following.begin;
+    }
+    --data_->size;
+    if (groups[group].begin == GroupEnd(group)) {
+      std::copy(groups + group + 1, groups + NumGroups(), groups + group);
+      --data_->num_groups;
+    }
+    return true;
+  }
+
+  bool Contains(EdgeTypeId edge_type, Vertex *vertex, EdgeRef edge) const {
+    auto edges = EdgesOfType(edge_type);
+    return std::any_of(edges.begin(), edges.end(),
+                       [&](const auto &entry) { return entry.vertex == vertex && entry.edge == edge; });
+  }
+
+ private:
+  struct Group {
+    EdgeTypeId type;
+    uint32_t begin;
+  };
+
+  // Start of the heap block, followed by `group_capacity` groups and then by
+  // `capacity` entries.
+  struct Header {
+    uint32_t num_groups;
+    uint32_t group_capacity;
+    uint32_t size;
+    uint32_t capacity;
+  };
+
+  static_assert(sizeof(Header) % alignof(Group) == 0 && sizeof(Group) % alignof(Entry) == 0);
+
+  size_t NumGroups() const { return data_ ? data_->num_groups : 0; }
+  size_t GroupCapacity() const { return data_ ? data_->group_capacity : 0; }
+  size_t Capacity() const { return data_ ? data_->capacity : 0; }
+
+  Group *Groups() const { return reinterpret_cast<Group *>(data_ + 1); }
+  Entry *Entries() const { return reinterpret_cast<Entry *>(Groups() + data_->group_capacity); }
+
+  static size_t Grown(size_t capacity, size_t needed) {
+    return capacity >= needed ? capacity : std::max(needed, capacity * 2);
+  }
+
+  // Moves the groups and the entries into a new block with the given
+  // capacities, which have to fit the current contents.
+  void Reallocate(size_t group_capacity, size_t capacity) {
+    MG_ASSERT(capacity <= std::numeric_limits<uint32_t>::max(), "Too many edges of a vertex!");
+    auto *data = static_cast<Header *>(
+        ::operator new(sizeof(Header) + group_capacity * sizeof(Group) + capacity * sizeof(Entry)));
+    *data = Header{.num_groups = static_cast<uint32_t>(NumGroups()),
+                   .group_capacity = static_cast<uint32_t>(group_capacity),
+                   .size = static_cast<uint32_t>(size()),
+                   .capacity = static_cast<uint32_t>(capacity)};
+    if (data_) {
+      std::copy_n(Groups(), data_->num_groups, reinterpret_cast<Group *>(data + 1));
+      std::copy_n(Entries(), data_->size,
+                  reinterpret_cast<Entry *>(reinterpret_cast<Group *>(data + 1) + group_capacity));
+      ::operator delete(data_);
+    }
+    data_ = data;
+  }
+
+  // Returns the index of the group with the given type, or the index at which
+  // such a group should be inserted to keep the groups sorted by type.
+  size_t FindGroup(EdgeTypeId edge_type) const {
+    if (!data_) return 0;
+    const auto *groups = Groups();
+    return std::lower_bound(groups, groups + NumGroups(), edge_type,
+                            [](const auto &group, const auto &type) { return group.type < type; }) -
+           groups;
+  }
+
+  size_t GroupEnd(size_t group) const { return group + 1 < NumGroups() ? Groups()[group + 1].begin : size(); }
+
+  // Groups are sorted both by type and by their position in the entries.
+  Header *data_{nullptr};
+};
+
+static_assert(sizeof(VertexEdges) == sizeof(void *), "VertexEdges should be a single pointer!");
+
+}  // namespace memgraph::storage
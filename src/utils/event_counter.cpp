@@ -54,6 +54,7 @@
   M(ForeachOperator, Operator, "Number of times Foreach operator was used.")                                         \
   M(EvaluatePatternFilterOperator, Operator, "Number of times EvaluatePatternFilter operator was used.")             \
   M(ApplyOperator, Operator, "Number of times ApplyOperator operator was used.")                                     \
+  M(HashJoinOperator, Operator, "Number of times HashJoin operator was used.")                                       \
                                                                                                                      \
   M(ActiveLabelIndices, Index, "Number of active label indices in the system.")                                      \
   M(ActiveLabelPropertyIndices, Index, "Number of active label property indices in the system<.")                    \
@@ -74,7 +75,11 @@
   M(ActiveTransactions, Transaction, "Number of active transactions.")                                               \
   M(CommitedTransactions, Transaction, "Number of committed transactions.")                                          \
   M(RollbackedTransactions, Transaction, "Number of rollbacked transactions.")                                       \
-  M(FailedQuery, Transaction, "Number of times executing a query failed.")
+  M(FailedQuery, Transaction, "Number of times executing a query failed.")                                           \
+                                                                                                                     \
+  M(DiskBlockCacheHits, Disk, "Number of on-disk storage blocks found in the block cache.")                          \
+  M(DiskBlockReads, Disk, "Number of on-disk storage blocks read from the disk.")                                    \
+  M(DiskBytesRead, Disk, "Number of bytes of on-disk storage blocks read from the disk.")
 
 namespace memgraph::metrics {
 // define every Event as an index in the array of counters
@@ -85,22 +90,41 @@ APPLY_FOR_COUNTERS(M)
 
 inline constexpr Event END = __COUNTER__;
 
+// Every shard takes whole cache lines.
+inline constexpr size_t kCacheLineSize = 64;
+inline constexpr size_t kShardSize =
+    (END * sizeof(Counter) + kCacheLineSize - 1) / kCacheLineSize * kCacheLineSize / sizeof(Counter);
+
 // Initialize array for the global counter with all values set to 0
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-Counter global_counters_array[END]{};
+alignas(kCacheLineSize) Counter global_counters_array[kNumShards * kShardSize]{};
 
 // Initialize global counters
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-EventCounters global_counters(global_counters_array);
+EventCounters global_counters(global_counters_array, kShardSize);
 
 const Event EventCounters::num_counters = END;
 
+size_t CurrentShard() {
+  static std::atomic<size_t> next_shard{0};
+  thread_local const size_t shard = next_shard.fetch_add(1, std::memory_order_relaxed) % kNumShards;
+  return shard;
+}
+
+Count EventCounters::Value(const Event event) const {
+  Count value = 0;
+  for (size_t shard = 0; shard < kNumShards; ++shard) {
+    value += counters_[shard * shard_size_ + event].load(std::memory_order_relaxed);
+  }
+  return value;
+}
+
 void EventCounters::Increment(const Event event, Count amount) {
-  counters_[event].fetch_add(amount, std::memory_order_relaxed);
+  counters_[CurrentShard() * shard_size_ + event].fetch_add(amount, std::memory_order_relaxed);
 }
 
 void EventCounters::Decrement(const Event event, Count amount) {
-  counters_[event].fetch_sub(amount, std::memory_order_relaxed);
+  counters_[CurrentShard() * shard_size_ + event].fetch_sub(amount, std::memory_order_relaxed);
 }
 
 void IncrementCounter(const Event event, Count amount) { global_counters.Increment(event, amount); }
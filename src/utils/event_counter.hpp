@@ -12,6 +12,8 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <memory>
 
@@ -20,13 +22,31 @@ using Event = uint64_t;
 using Count = uint64_t;
 using Counter = std::atomic<Count>;
 
+/// Number of shards of the counters and the histograms.
+inline constexpr size_t kNumShards = 64;
+
+/// Returns the shard which is used by the calling thread. Threads get the
+/// shards round-robin when they use them for the first time.
+size_t CurrentShard();
+
+/// Event counters which are updated on hot paths, e.g. for every operator and
+/// Bolt message.
+///
+/// Every counter has one value per shard, and all of the values of a shard are
+/// next to each other, so that threads which use different shards don't
+/// update the same cache lines. The values are summed when the counter is
+/// read, which happens only when the metrics are collected. The counters are
+/// unsigned, so a counter which is decremented in another shard than it was
+/// incremented in still has the right total.
 class EventCounters {
  public:
-  explicit EventCounters(Counter *allocated_counters) noexcept : counters_(allocated_counters) {}
-
-  auto &operator[](const Event event) { return counters_[event]; }
+  /// `allocated_counters` must have `kNumShards * shard_size` counters, and
+  /// `shard_size` must be at least `num_counters`.
+  EventCounters(Counter *allocated_counters, size_t shard_size) noexcept
+      : counters_(allocated_counters), shard_size_(shard_size) {}
 
-  const auto &operator[](const Event event) const { return counters_[event]; }
+  /// Returns the value of the counter summed over all shards.
+  Count Value(Event event) const;
 
   void Increment(Event event, Count amount = 1);
 
@@ -36,6 +56,7 @@ class EventCounters {
 
  private:
   Counter *counters_;
+  size_t shard_size_;
 };
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
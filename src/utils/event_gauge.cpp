@@ -11,8 +11,10 @@
 
 #include "utils/event_gauge.hpp"
 
-// We don't have any gauges for now
-#define APPLY_FOR_GAUGES(M)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define APPLY_FOR_GAUGES(M)                                                                                            \
+  M(GCPendingUndoBuffers, Memory, "Number of undo buffers waiting to be freed by the garbage collector")               \
+  M(GCPendingVertices, Memory, "Number of deleted vertices waiting to be freed by the garbage collector")
 
 namespace memgraph::metrics {
 
@@ -12,10 +12,23 @@
 #include "utils/event_histogram.hpp"
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
-#define APPLY_FOR_HISTOGRAMS(M)                                                                    \
-  M(QueryExecutionLatency_us, Query, "Query execution latency in microseconds", 50, 90, 99)        \
-  M(SnapshotCreationLatency_us, Snapshot, "Snapshot creation latency in microseconds", 50, 90, 99) \
-  M(SnapshotRecoveryLatency_us, Snapshot, "Snapshot recovery latency in microseconds", 50, 90, 99)
+#define APPLY_FOR_HISTOGRAMS(M)                                                                                        \
+  M(QueryExecutionLatency_us, Query, "Query execution latency in microseconds", 50, 90, 99)                            \
+  M(CommitLatency_us, Transaction, "Transaction commit latency in microseconds", 50, 90, 99)                           \
+  M(CommitLockWaitLatency_ns, Transaction, "Wait for the engine lock during commit in nanoseconds", 50, 90, 99)        \
+  M(SnapshotCreationLatency_us, Snapshot, "Snapshot creation latency in microseconds", 50, 90, 99)                     \
+  M(SnapshotCreationThroughput, Snapshot, "Vertices and edges written to a snapshot per second", 50, 90, 99)           \
+  M(SnapshotRecoveryLatency_us, Snapshot, "Snapshot recovery latency in microseconds", 50, 90, 99)                     \
+  M(WalEncodeLatency_us, Durability, "Latency of encoding the WAL deltas of a commit in microseconds", 50, 90, 99)     \
+  M(WalFlushLatency_us, Durability, "Latency of flushing the WAL buffer after a commit in microseconds", 50, 90, 99)   \
+  M(WalSyncLatency_us, Durability, "Latency of a single WAL fsync in microseconds", 50, 90, 99)                        \
+  M(WalSyncBatchSize, Durability, "Number of transactions made durable by a single WAL fsync", 50, 90, 99)             \
+  M(GCLatency_us, Memory, "Garbage collection latency in microseconds", 50, 90, 99)                                    \
+  M(GCUnlinkLatency_us, Memory, "Latency of unlinking deltas of finished transactions in microseconds", 50, 90, 99)    \
+  M(GCIndexCleanupLatency_us, Memory, "Latency of removing obsolete index entries in microseconds", 50, 90, 99)        \
+  M(GCFreeLatency_us, Memory, "Latency of freeing undo buffers, vertices and edges in microseconds", 50, 90, 99)       \
+  M(IndexCreationLatency_us, Index, "Latency of creating and populating an index in microseconds", 50, 90, 99)         \
+  M(DiskBytesReadPerTransaction, Disk, "Number of bytes of on-disk storage blocks read by a transaction", 50, 90, 99)
 
 namespace memgraph::metrics {
 
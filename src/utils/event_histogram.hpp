@@ -11,8 +11,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
 
+#include "utils/event_counter.hpp"
 #include "utils/logging.hpp"
 
 namespace memgraph::metrics {
@@ -33,7 +41,8 @@ using Measurement = std::atomic<uint64_t>;
 // * roughly 1% precision loss - can be higher for values
 //   less than 100, so if measuring latency, generally do
 //   so in microseconds.
-// * ~32kb constant space, single allocation per Histogram.
+// * ~32kb per shard, allocated once per shard which measured
+//   a value. Measuring doesn't take any locks.
 // * Histogram::Percentile() will return 0 if there were no
 //   samples measured yet.
 class Histogram {
@@ -50,34 +59,66 @@ class Histogram {
   // within 4096 samples while still achieving a high accuracy.
   constexpr static auto kPrecision = 92.0;
 
-  // samples_ stores per-bucket counts for measurements
-  // that have been mapped to a specific uint64_t in
-  // the "compression" logic below.
-  std::vector<uint64_t> samples_ = {};
+  // Every shard has a whole copy of the buckets, so histograms use fewer
+  // shards than the counters. Threads whose shards differ only in the upper
+  // bits share the histogram shard.
+  constexpr static size_t kHistogramShards = 16;
+
+  // Shard holds the per-bucket counts of the measurements
+  // that have been mapped to a specific uint64_t in the
+  // "compression" logic below, together with the count
+  // and the sum of the measurements.
+  struct alignas(64) Shard {
+    Measurement count = 0;
+    Measurement sum = 0;
+    std::array<Measurement, kSampleLimit> samples{};
+  };
+
+  // Shards are allocated when a thread of the shard measures
+  // a value for the first time, so that histograms which are
+  // measured by few threads stay small. They are merged when
+  // the histogram is read.
+  std::array<std::atomic<Shard *>, kHistogramShards> shards_{};
 
   std::vector<uint8_t> percentiles_;
 
-  // count_ is the number of measurements that have been
-  // included in this Histogram.
-  Measurement count_ = 0;
+ public:
+  Histogram() { percentiles_ = {0, 25, 50, 75, 90, 100}; }
 
-  // sum_ is the summed value of all measurements that
-  // have been included in this Histogram.
-  Measurement sum_ = 0;
+  explicit Histogram(std::vector<uint8_t> percentiles) : percentiles_(percentiles) {}
 
-  std::mutex samples_mutex_;
+  Histogram(const Histogram &) = delete;
+  Histogram &operator=(const Histogram &) = delete;
+  Histogram(Histogram &&) = delete;
+  Histogram &operator=(Histogram &&) = delete;
 
- public:
-  Histogram() {
-    samples_.resize(kSampleLimit, 0);
-    percentiles_ = {0, 25, 50, 75, 90, 100};
+  ~Histogram() {
+    for (auto &shard : shards_) {
+      delete shard.load(std::memory_order_relaxed);
+    }
   }
 
-  explicit Histogram(std::vector<uint8_t> percentiles) : percentiles_(percentiles) { samples_.resize(kSampleLimit, 0); }
-
-  uint64_t Count() const { return count_.load(std::memory_order_relaxed); }
+  // count is the number of measurements that have been
+  // included in this Histogram.
+  uint64_t Count() const {
+    uint64_t count = 0;
+    for (const auto &shard : shards_) {
+      const auto *data = shard.load(std::memory_order_acquire);
+      if (data) count += data->count.load(std::memory_order_relaxed);
+    }
+    return count;
+  }
 
-  uint64_t Sum() const { return sum_.load(std::memory_order_relaxed); }
+  // sum is the summed value of all measurements that
+  // have been included in this Histogram.
+  uint64_t Sum() const {
+    uint64_t sum = 0;
+    for (const auto &shard : shards_) {
+      const auto *data = shard.load(std::memory_order_acquire);
+      if (data) sum += data->sum.load(std::memory_order_relaxed);
+    }
+    return sum;
+  }
 
   std::vector<uint8_t> Percentiles() const { return percentiles_; }
 
@@ -90,31 +131,62 @@ class Histogram {
     MG_ASSERT(compressed < kSampleLimit, "compressing value {} to {} is invalid", value, compressed);
     auto sample_index = static_cast<uint16_t>(compressed);
 
-    count_.fetch_add(1, std::memory_order_relaxed);
-    sum_.fetch_add(value, std::memory_order_relaxed);
-
-    {
-      std::lock_guard<std::mutex> lock(samples_mutex_);
-      samples_[sample_index]++;
-    }
+    auto &shard = CurrentShardData();
+    shard.count.fetch_add(1, std::memory_order_relaxed);
+    shard.sum.fetch_add(value, std::memory_order_relaxed);
+    shard.samples[sample_index].fetch_add(1, std::memory_order_relaxed);
   }
 
   std::vector<std::pair<uint64_t, uint64_t>> YieldPercentiles() const {
     std::vector<std::pair<uint64_t, uint64_t>> percentile_yield;
     percentile_yield.reserve(percentiles_.size());
 
+    const auto samples = MergeSamples();
     for (const auto percentile : percentiles_) {
-      percentile_yield.emplace_back(std::make_pair(percentile, Percentile(percentile)));
+      percentile_yield.emplace_back(std::make_pair(percentile, Percentile(samples, percentile)));
     }
 
     return percentile_yield;
   }
 
-  uint64_t Percentile(double percentile) const {
+  uint64_t Percentile(double percentile) const { return Percentile(MergeSamples(), percentile); }
+
+ private:
+  Shard &CurrentShardData() {
+    auto &shard = shards_[CurrentShard() % kHistogramShards];
+    auto *data = shard.load(std::memory_order_acquire);
+    if (data) return *data;
+
+    auto new_data = std::make_unique<Shard>();
+    if (shard.compare_exchange_strong(data, new_data.get(), std::memory_order_acq_rel, std::memory_order_acquire)) {
+      return *new_data.release();
+    }
+    // Another thread of the same shard allocated it first.
+    return *data;
+  }
+
+  // Sums the buckets of all shards. The total count is taken from the merged
+  // buckets, so that it matches them while other threads measure values.
+  std::vector<uint64_t> MergeSamples() const {
+    std::vector<uint64_t> samples(kSampleLimit, 0);
+    for (const auto &shard : shards_) {
+      const auto *data = shard.load(std::memory_order_acquire);
+      if (!data) continue;
+      for (int i = 0; i < kSampleLimit; i++) {
+        samples[i] += data->samples[i].load(std::memory_order_relaxed);
+      }
+    }
+    return samples;
+  }
+
+  static uint64_t Percentile(const std::vector<uint64_t> &samples, double percentile) {
     MG_ASSERT(percentile <= 100.0, "percentiles must not exceed 100.0");
     MG_ASSERT(percentile >= 0.0, "percentiles must be greater than or equal to 0.0");
 
-    auto count = Count();
+    uint64_t count = 0;
+    for (const auto samples_at_index : samples) {
+      count += samples_at_index;
+    }
 
     if (count == 0) {
       return 0;
@@ -126,7 +198,7 @@ class Histogram {
     auto scanned = 0.0;
 
     for (int i = 0; i < kSampleLimit; i++) {
-      const auto samples_at_index = samples_[i];
+      const auto samples_at_index = samples[i];
       scanned += static_cast<double>(samples_at_index);
       if (scanned >= target) {
         // "decompression" logic
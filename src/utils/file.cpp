@@ -427,21 +427,28 @@ bool OutputFile::AcquireLock() {
   return ret != -1;
 }
 
-void OutputFile::Sync() {
-  FlushBuffer(true);
-
+namespace {
+int FsyncDescriptor(int fd) {
   int ret = 0;
   while (true) {
-    ret = fsync(fd_);
+    ret = fsync(fd);
     if (ret == -1 && errno == EINTR) {
       // The call was interrupted, try again...
       continue;
     } else {
-      // All other possible errors are fatal errors and are handled in the
-      // MG_ASSERT below.
+      // All other possible errors are fatal errors and are handled by the
+      // caller.
       break;
     }
   }
+  return ret;
+}
+}  // namespace
+
+void OutputFile::Sync() {
+  FlushBuffer(true);
+
+  int ret = FsyncDescriptor(fd_);
 
   // In this check we are extremely rigorous because any error except EINTR is
   // treated as a fatal error that will crash the database. The errors that will
@@ -475,6 +482,27 @@ void OutputFile::Sync() {
   written_since_last_sync_ = 0;
 }
 
+FileSyncHandle OutputFile::SyncHandle() {
+  FlushBuffer(true);
+
+  int fd = -1;
+  while (true) {
+    fd = fcntl(fd_, F_DUPFD_CLOEXEC, 0);
+    if (fd == -1 && errno == EINTR) {
+      // The call was interrupted, try again...
+      continue;
+    } else {
+      // All other possible errors are fatal errors and are handled in the
+      // MG_ASSERT below.
+      break;
+    }
+  }
+
+  MG_ASSERT(fd != -1, "While trying to duplicate the descriptor of {}, an error occurred: {} ({})", path_,
+            strerror(errno), errno);
+  return {fd, path_};
+}
+
 void OutputFile::Close() noexcept {
   FlushBuffer(true);
 
@@ -563,4 +591,45 @@ void OutputFile::TryFlushing() {
   }
 }
 
+FileSyncHandle::FileSyncHandle(int fd, std::filesystem::path path) : fd_(fd), path_(std::move(path)) {}
+
+FileSyncHandle::~FileSyncHandle() { Close(); }
+
+FileSyncHandle::FileSyncHandle(FileSyncHandle &&other) noexcept : fd_(other.fd_), path_(std::move(other.path_)) {
+  other.fd_ = -1;
+}
+
+FileSyncHandle &FileSyncHandle::operator=(FileSyncHandle &&other) noexcept {
+  if (this != &other) {
+    Close();
+    fd_ = other.fd_;
+    path_ = std::move(other.path_);
+    other.fd_ = -1;
+  }
+  return *this;
+}
+
+void FileSyncHandle::Sync() {
+  MG_ASSERT(fd_ != -1, "Syncing an invalid file handle.");
+  // Same as in `OutputFile::Sync`, any error except EINTR is fatal.
+  const int ret = FsyncDescriptor(fd_);
+  MG_ASSERT(ret == 0, "While trying to sync {}, an error occurred: {} ({}).", path_, strerror(errno), errno);
+}
+
+void FileSyncHandle::Close() noexcept {
+  if (fd_ == -1) return;
+  int ret = 0;
+  while (true) {
+    ret = close(fd_);
+    if (ret == -1 && errno == EINTR) {
+      // The call was interrupted, try again...
+      continue;
+    } else {
+      break;
+    }
+  }
+  MG_ASSERT(ret == 0, "While trying to close {}, an error occurred: {} ({}).", path_, strerror(errno), errno);
+  fd_ = -1;
+}
+
 }  // namespace memgraph::utils
@@ -146,6 +146,36 @@ class InputFile {
   size_t buffer_position_{0};
 };
 
+/// Owns a duplicate of the file descriptor of an `OutputFile`, obtained with
+/// `OutputFile::SyncHandle`. Calling `Sync` on it makes all data that was
+/// written to the file before the handle was created durable. Because the
+/// `OutputFile` itself isn't touched, the sync can be performed on another
+/// thread (or without holding the lock that guards the writer) while the file
+/// keeps being written to.
+class FileSyncHandle {
+ public:
+  FileSyncHandle(int fd, std::filesystem::path path);
+  ~FileSyncHandle();
+
+  FileSyncHandle(const FileSyncHandle &) = delete;
+  FileSyncHandle &operator=(const FileSyncHandle &) = delete;
+
+  FileSyncHandle(FileSyncHandle &&other) noexcept;
+  FileSyncHandle &operator=(FileSyncHandle &&other) noexcept;
+
+  /// Syncs the data written before the creation of the handle to permanent
+  /// storage. On failure it crashes the program.
+  void Sync();
+
+  const std::filesystem::path &path() const { return path_; }
+
+ private:
+  void Close() noexcept;
+
+  int fd_{-1};
+  std::filesystem::path path_;
+};
+
 /// This class implements a file handler that is used for mission critical files
 /// that need to be written and synced to permanent storage. Typical usage for
 /// this class is in implementation of write-ahead logging or anything similar
@@ -235,6 +265,11 @@ class OutputFile {
   /// and misuse it crashes the program.
   void Sync();
 
+  /// Writes the internal buffer to the file and returns a handle which can be
+  /// used to sync the written data independently of this object. On failure
+  /// and misuse it crashes the program.
+  FileSyncHandle SyncHandle();
+
   /// Closes the currently opened file. It doesn't perform a `Sync` on the
   /// file. On failure and misuse it crashes the program.
   void Close() noexcept;
@@ -0,0 +1,110 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "communication/bolt/v1/encoder/base_encoder.hpp"
+#include "glue/bolt_encoder.hpp"
+#include "glue/communication.hpp"
+#include "query/typed_value.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+
+// Compares encoding of result rows which contain a single vertex through
+// ToBoltValue with encoding them straight from the storage.
+
+namespace {
+
+constexpr int64_t kNumVertices = 1'000'000;
+constexpr int64_t kNumProperties = 20;
+
+memgraph::storage::Storage &Database() {
+  static auto db = [] {
+    std::unique_ptr<memgraph::storage::Storage> db = std::make_unique<memgraph::storage::InMemoryStorage>();
+    auto acc = db->Access();
+    const auto label = db->NameToLabel("Person");
+    std::vector<memgraph::storage::PropertyId> properties;
+    for (int64_t i = 0; i < kNumProperties; ++i) {
+      properties.push_back(db->NameToProperty("property_" + std::to_string(i)));
+    }
+    for (int64_t i = 0; i < kNumVertices; ++i) {
+      auto vertex = acc->CreateVertex();
+      MG_ASSERT(vertex.AddLabel(label).HasValue());
+      for (int64_t j = 0; j < kNumProperties; ++j) {
+        // Mix of integers and strings, which are the most common property types.
+        const auto value = j % 2 == 0 ? memgraph::storage::PropertyValue(i * j)
+                                      : memgraph::storage::PropertyValue("value_" + std::to_string(i + j));
+        MG_ASSERT(vertex.SetProperty(properties[j], value).HasValue());
+      }
+    }
+    MG_ASSERT(!acc->Commit().HasError());
+    return db;
+  }();
+  return *db;
+}
+
+std::vector<memgraph::query::TypedValue> Rows(memgraph::storage::Storage::Accessor &acc) {
+  std::vector<memgraph::query::TypedValue> rows;
+  rows.reserve(kNumVertices);
+  for (auto vertex : acc.Vertices(memgraph::storage::View::OLD)) {
+    rows.emplace_back(memgraph::query::VertexAccessor(vertex));
+  }
+  return rows;
+}
+
+}  // namespace
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void EncodeThroughBoltValue(benchmark::State &state) {
+  auto &db = Database();
+  auto acc = db.Access();
+  const auto rows = Rows(*acc);
+  memgraph::glue::BoltRecordBuffer buffer;
+  memgraph::communication::bolt::BaseEncoder<memgraph::glue::BoltRecordBuffer> encoder(buffer);
+  encoder.UpdateVersion(5);
+  for (auto _ : state) {
+    for (const auto &row : rows) {
+      buffer.Clear();
+      auto maybe_value = memgraph::glue::ToBoltValue(row, db, memgraph::storage::View::OLD);
+      MG_ASSERT(maybe_value.HasValue());
+      encoder.WriteValue(*maybe_value);
+      benchmark::DoNotOptimize(buffer.data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kNumVertices);
+}
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void EncodeDirectly(benchmark::State &state) {
+  auto &db = Database();
+  auto acc = db.Access();
+  const auto rows = Rows(*acc);
+  memgraph::glue::BoltRecordBuffer buffer;
+  memgraph::glue::TypedValueEncoder<memgraph::glue::BoltRecordBuffer> encoder(buffer, db,
+                                                                              memgraph::storage::View::OLD);
+  encoder.UpdateVersion(5);
+  for (auto _ : state) {
+    for (const auto &row : rows) {
+      buffer.Clear();
+      MG_ASSERT(!encoder.WriteTypedValue(row).HasError());
+      benchmark::DoNotOptimize(buffer.data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kNumVertices);
+}
+
+BENCHMARK(EncodeThroughBoltValue)->Unit(benchmark::kMillisecond);
+BENCHMARK(EncodeDirectly)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
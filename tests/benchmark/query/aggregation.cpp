@@ -0,0 +1,90 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+//////////////////////////////////////////////////////
+// THIS INCLUDE SHOULD ALWAYS COME BEFORE THE
+// OTHER INCLUDES
+// "planner.hpp" includes json.hpp which uses libc's
+// EOF macro while in the other includes
+// <antlr4-runtime.h> is included which contains a static
+// variable of the same name, EOF.
+// This hides the definition of the macro which causes
+// the compilation to fail.
+#include "query/plan/planner.hpp"
+//////////////////////////////////////////////////////
+#include "query/frontend/opencypher/parser.hpp"
+#include "query/frontend/semantic/symbol_generator.hpp"
+#include "query/interpreter.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+
+// Grouped aggregation over rows produced by UNWIND. An integer key is handled
+// by the flat single-key aggregation, while the same key converted to a double
+// goes through the generic aggregation, which makes the two directly comparable.
+
+static memgraph::query::CypherQuery *ParseCypherQuery(const std::string &query_string,
+                                                      memgraph::query::AstStorage *ast) {
+  memgraph::query::frontend::ParsingContext parsing_context;
+  parsing_context.is_query_cached = false;
+  memgraph::query::frontend::opencypher::Parser parser(query_string);
+  // Convert antlr4 AST into Memgraph AST.
+  memgraph::query::frontend::CypherMainVisitor cypher_visitor(parsing_context, ast);
+  cypher_visitor.visit(parser.tree());
+  return memgraph::utils::Downcast<memgraph::query::CypherQuery>(cypher_visitor.query());
+};
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void GroupedAggregation(benchmark::State &state, const std::string &key_expression) {
+  memgraph::query::AstStorage ast;
+  memgraph::query::Parameters parameters;
+  std::unique_ptr<memgraph::storage::Storage> db(new memgraph::storage::InMemoryStorage());
+  auto storage_dba = db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  const auto key = fmt::format(fmt::runtime(key_expression), "x % " + std::to_string(state.range(1)));
+  const auto query_string = "UNWIND range(1, " + std::to_string(state.range(0)) + ") AS x RETURN " + key +
+                            " AS k, count(*) AS c, sum(x) AS s";
+  auto *cypher_query = ParseCypherQuery(query_string, &ast);
+  auto symbol_table = memgraph::query::MakeSymbolTable(cypher_query);
+  auto context = memgraph::query::plan::MakePlanningContext(&ast, &symbol_table, cypher_query, &dba);
+  auto plan_and_cost = memgraph::query::plan::MakeLogicalPlan(&context, parameters, false);
+  memgraph::utils::MonotonicBufferResource per_pull_memory(memgraph::query::kExecutionMemoryBlockSize);
+  memgraph::query::EvaluationContext evaluation_context{&per_pull_memory};
+  while (state.KeepRunning()) {
+    memgraph::query::ExecutionContext execution_context{
+        .db_accessor = &dba, .symbol_table = symbol_table, .evaluation_context = evaluation_context};
+    memgraph::utils::MonotonicBufferResource memory(memgraph::query::kExecutionMemoryBlockSize);
+    memgraph::query::Frame frame(symbol_table.max_position(), &memory);
+    auto cursor = plan_and_cost.first->MakeCursor(&memory);
+    while (cursor->Pull(frame, execution_context)) per_pull_memory.Release();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_CAPTURE(GroupedAggregation, IntKey, "{}")
+    ->Args({50'000'000, 16})
+    ->Args({50'000'000, 1'000'000})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(GroupedAggregation, StringKey, "toString({})")
+    ->Args({50'000'000, 16})
+    ->Args({50'000'000, 1'000'000})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(GroupedAggregation, GenericDoubleKey, "toFloat({})")
+    ->Args({50'000'000, 16})
+    ->Args({50'000'000, 1'000'000})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
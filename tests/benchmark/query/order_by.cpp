@@ -0,0 +1,109 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+//////////////////////////////////////////////////////
+// THIS INCLUDE SHOULD ALWAYS COME BEFORE THE
+// OTHER INCLUDES
+// "planner.hpp" includes json.hpp which uses libc's
+// EOF macro while in the other includes
+// <antlr4-runtime.h> is included which contains a static
+// variable of the same name, EOF.
+// This hides the definition of the macro which causes
+// the compilation to fail.
+#include "query/plan/planner.hpp"
+//////////////////////////////////////////////////////
+#include "query/frontend/opencypher/parser.hpp"
+#include "query/frontend/semantic/symbol_generator.hpp"
+#include "query/interpreter.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+
+// Compares the fused top-K OrderBy against the full sort it replaces for the
+// `ORDER BY x DESC LIMIT k` pattern. Rows come from UNWIND so that the
+// benchmark measures the ordering itself and not the storage scan.
+
+static memgraph::query::CypherQuery *ParseCypherQuery(const std::string &query_string,
+                                                      memgraph::query::AstStorage *ast) {
+  memgraph::query::frontend::ParsingContext parsing_context;
+  parsing_context.is_query_cached = false;
+  memgraph::query::frontend::opencypher::Parser parser(query_string);
+  // Convert antlr4 AST into Memgraph AST.
+  memgraph::query::frontend::CypherMainVisitor cypher_visitor(parsing_context, ast);
+  cypher_visitor.visit(parser.tree());
+  return memgraph::utils::Downcast<memgraph::query::CypherQuery>(cypher_visitor.query());
+};
+
+// Removes the fused SKIP/LIMIT from every OrderBy in the plan, which makes it
+// fall back to sorting the whole input.
+class DisableTopK : public memgraph::query::plan::HierarchicalLogicalOperatorVisitor {
+ public:
+  using HierarchicalLogicalOperatorVisitor::PostVisit;
+  using HierarchicalLogicalOperatorVisitor::PreVisit;
+  using HierarchicalLogicalOperatorVisitor::Visit;
+
+  bool PreVisit(memgraph::query::plan::OrderBy &op) override {
+    op.skip_ = nullptr;
+    op.limit_ = nullptr;
+    return true;
+  }
+
+  bool Visit(memgraph::query::plan::Once &) override { return true; }
+};
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void OrderByLimit(benchmark::State &state, bool top_k) {
+  memgraph::query::AstStorage ast;
+  memgraph::query::Parameters parameters;
+  std::unique_ptr<memgraph::storage::Storage> db(new memgraph::storage::InMemoryStorage());
+  auto storage_dba = db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  // Multiplying by a prime modulo a larger prime shuffles the input so that
+  // neither the heap nor the sort see presorted data.
+  const auto query_string = "UNWIND range(1, " + std::to_string(state.range(0)) +
+                            ") AS x RETURN (x * 7919) % 10000019 AS y ORDER BY y DESC LIMIT " +
+                            std::to_string(state.range(1));
+  auto *cypher_query = ParseCypherQuery(query_string, &ast);
+  auto symbol_table = memgraph::query::MakeSymbolTable(cypher_query);
+  auto context = memgraph::query::plan::MakePlanningContext(&ast, &symbol_table, cypher_query, &dba);
+  auto plan_and_cost = memgraph::query::plan::MakeLogicalPlan(&context, parameters, false);
+  if (!top_k) {
+    DisableTopK visitor;
+    plan_and_cost.first->Accept(visitor);
+  }
+  memgraph::utils::MonotonicBufferResource per_pull_memory(memgraph::query::kExecutionMemoryBlockSize);
+  memgraph::query::EvaluationContext evaluation_context{&per_pull_memory};
+  while (state.KeepRunning()) {
+    memgraph::query::ExecutionContext execution_context{
+        .db_accessor = &dba, .symbol_table = symbol_table, .evaluation_context = evaluation_context};
+    memgraph::utils::MonotonicBufferResource memory(memgraph::query::kExecutionMemoryBlockSize);
+    memgraph::query::Frame frame(symbol_table.max_position(), &memory);
+    auto cursor = plan_and_cost.first->MakeCursor(&memory);
+    while (cursor->Pull(frame, execution_context)) per_pull_memory.Release();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_CAPTURE(OrderByLimit, FullSort, false)
+    ->Args({1'000'000, 10})
+    ->Args({10'000'000, 10})
+    ->Args({10'000'000, 1000})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(OrderByLimit, TopK, true)
+    ->Args({1'000'000, 10})
+    ->Args({10'000'000, 10})
+    ->Args({10'000'000, 1000})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
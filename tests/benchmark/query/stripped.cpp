@@ -43,6 +43,9 @@ const char *kQueries[] = {
 "MATCH (n:X {foo: 'A'}) SET n += {foo: null} RETURN n",
 "MATCH (n) WITH n LIMIT toInteger(ceil(1.7)) RETURN count(*) AS count",
 "MATCH (a:A), (b:B) MERGE (a)-[r:TYPE]->(b) ON CREATE SET r.name = 'Lola' RETURN count(r)",
+"MATCH (n:User {id: $id}) RETURN n.name, n.age",
+"MATCH (a:Person {name: $name})-[:KNOWS]->(b) WHERE b.age > 30 RETURN b.name AS name LIMIT 10",
+"MERGE (n:Account {id: $id}) SET n.balance = n.balance + $amount, n.updated = timestamp()",
 "CREATE (:L1:L2:L3:L4:L5:L6:L7 {p1: true, p2: 42, p3: \"Here is some text that is not extremely short\", p4:\"Short text\", p5: 234.434, p6: 11.11, p7: false})",
 };
 // clang-format on
@@ -9,6 +9,7 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <deque>
 #include <optional>
 #include <thread>
 
@@ -77,6 +78,25 @@ static void BenchmarkRpcPool(benchmark::State &state) {
   state.SetItemsProcessed(state.iterations());
 }
 
+// Keeps `state.range(1)` calls in flight on the connection of the thread.
+static void BenchmarkRpcPipelined(benchmark::State &state) {
+  std::string data(state.range(0), 'a');
+  const auto depth = static_cast<size_t>(state.range(1));
+  std::deque<memgraph::rpc::Client::StreamHandler<Echo>> in_flight;
+  while (state.KeepRunning()) {
+    if (in_flight.size() == depth) {
+      in_flight.front().AwaitResponse();
+      in_flight.pop_front();
+    }
+    in_flight.push_back(clients[state.thread_index()]->CallAsync<Echo>(data));
+  }
+  while (!in_flight.empty()) {
+    in_flight.front().AwaitResponse();
+    in_flight.pop_front();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
 BENCHMARK(BenchmarkRpc)
     ->RangeMultiplier(4)
     ->Range(4, 1 << 13)
@@ -91,6 +111,12 @@ BENCHMARK(BenchmarkRpcPool)
     ->Unit(benchmark::kNanosecond)
     ->UseRealTime();
 
+BENCHMARK(BenchmarkRpcPipelined)
+    ->ArgsProduct({{4, 1 << 10, 1 << 13}, {1, 4, 16, 64}})
+    ->ThreadRange(1, kThreadsNum)
+    ->Unit(benchmark::kNanosecond)
+    ->UseRealTime();
+
 int main(int argc, char **argv) {
   ::benchmark::Initialize(&argc, argv);
   gflags::AllowCommandLineReparsing();
@@ -26,6 +26,7 @@ const int kNumVertices = 1000000;
 DEFINE_int32(num_threads, 4, "number of threads");
 DEFINE_int32(num_vertices, kNumVertices, "number of vertices");
 DEFINE_int32(num_iterations, kNumIterations, "number of iterations");
+DEFINE_int32(num_bulk_deltas, kNumVertices, "number of deltas created by a single bulk transaction");
 
 std::pair<std::string, memgraph::storage::Config> TestConfigurations[] = {
     {"NoGc", memgraph::storage::Config{.gc = {.type = memgraph::storage::Config::Gc::Type::NONE}}},
@@ -54,6 +55,29 @@ void UpdateLabelFunc(int thread_id, memgraph::storage::Storage *storage,
   }
 }
 
+// Creates a large number of deltas in a single transaction which stresses the
+// allocation of deltas on commit and their release by the GC.
+void BulkIngest(const std::string &config_name, const memgraph::storage::Config &config) {
+  std::unique_ptr<memgraph::storage::Storage> storage(new memgraph::storage::InMemoryStorage(config));
+  const auto property = memgraph::storage::PropertyId::FromUint(0);
+
+  memgraph::utils::Timer timer;
+  {
+    auto acc = storage->Access();
+    // Every vertex gets a DELETE_OBJECT and a SET_PROPERTY delta.
+    for (int i = 0; i < FLAGS_num_bulk_deltas / 2; ++i) {
+      auto vertex = acc->CreateVertex();
+      MG_ASSERT(vertex.SetProperty(property, memgraph::storage::PropertyValue(i)).HasValue());
+    }
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+  const auto ingest_time = timer.Elapsed().count();
+  storage->FreeMemory();
+
+  std::cout << "Config: " << config_name << ", Bulk ingest time: " << ingest_time
+            << ", Bulk ingest and GC time: " << timer.Elapsed().count() << std::endl;
+}
+
 int main(int argc, char *argv[]) {
   gflags::ParseCommandLineFlags(&argc, &argv, true);
 
@@ -82,5 +106,9 @@ int main(int argc, char *argv[]) {
     std::cout << "Config: " << config.first << ", Time: " << timer.Elapsed().count() << std::endl;
   }
 
+  for (const auto &config : TestConfigurations) {
+    BulkIngest(config.first, config.second);
+  }
+
   return 0;
 }
@@ -82,6 +82,54 @@ static void PropertyStoreGet(benchmark::State &state) {
 
 BENCHMARK(PropertyStoreGet)->RangeMultiplier(2)->Range(1, 1024)->Unit(benchmark::kNanosecond)->UseRealTime();
 
+///////////////////////////////////////////////////////////////////////////////
+// PropertyStore Get and compare of the last property
+///////////////////////////////////////////////////////////////////////////////
+
+// Worst case for a sequential scan of the buffer, e.g. a `Filter` on a
+// property with a large ID of a vertex with many properties.
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void PropertyStoreGetLast(benchmark::State &state) {
+  memgraph::storage::PropertyStore store;
+  for (uint64_t i = 0; i < state.range(0); ++i) {
+    auto prop = memgraph::storage::PropertyId::FromUint(i);
+    store.SetProperty(prop, memgraph::storage::PropertyValue("value"));
+  }
+  auto prop = memgraph::storage::PropertyId::FromUint(state.range(0) - 1);
+  uint64_t counter = 0;
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(store.GetProperty(prop));
+    ++counter;
+  }
+  state.SetItemsProcessed(counter);
+}
+
+BENCHMARK(PropertyStoreGetLast)->RangeMultiplier(2)->Range(1, 1024)->Unit(benchmark::kNanosecond)->UseRealTime();
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void PropertyStoreIsPropertyEqualLast(benchmark::State &state) {
+  memgraph::storage::PropertyStore store;
+  for (uint64_t i = 0; i < state.range(0); ++i) {
+    auto prop = memgraph::storage::PropertyId::FromUint(i);
+    store.SetProperty(prop, memgraph::storage::PropertyValue("value"));
+  }
+  auto prop = memgraph::storage::PropertyId::FromUint(state.range(0) - 1);
+  const memgraph::storage::PropertyValue value("value");
+  uint64_t counter = 0;
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(store.IsPropertyEqual(prop, value));
+    ++counter;
+  }
+  state.SetItemsProcessed(counter);
+}
+
+BENCHMARK(PropertyStoreIsPropertyEqualLast)
+    ->RangeMultiplier(2)
+    ->Range(1, 1024)
+    ->Unit(benchmark::kNanosecond)
+    ->UseRealTime();
+
 ///////////////////////////////////////////////////////////////////////////////
 // std::map Get
 ///////////////////////////////////////////////////////////////////////////////
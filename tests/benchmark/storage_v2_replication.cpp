@@ -0,0 +1,81 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <filesystem>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/replication/config.hpp"
+#include "storage/v2/replication/enums.hpp"
+
+// Measures how long a commit on MAIN takes with a SYNC replica. The commit
+// returns only after the replica has applied the transaction, so the time is
+// dominated by the replica lag for larger transactions.
+
+namespace {
+
+const std::filesystem::path kStorageDirectory{std::filesystem::temp_directory_path() /
+                                              "MG_benchmark_storage_v2_replication"};
+const memgraph::io::network::Endpoint kReplicaEndpoint{"127.0.0.1", 10000};
+
+memgraph::storage::Config MakeConfig(const std::string &name) {
+  return {.items = {.properties_on_edges = true},
+          .durability = {
+              .storage_directory = kStorageDirectory / name,
+              .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+          }};
+}
+
+}  // namespace
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void ReplicaLag(benchmark::State &state) {
+  std::filesystem::remove_all(kStorageDirectory);
+  {
+    std::unique_ptr<memgraph::storage::Storage> main_store =
+        std::make_unique<memgraph::storage::InMemoryStorage>(MakeConfig("main"));
+    auto replica_store = std::make_unique<memgraph::storage::InMemoryStorage>(MakeConfig("replica"));
+    replica_store->SetReplicaRole(kReplicaEndpoint, memgraph::storage::replication::ReplicationServerConfig{});
+    MG_ASSERT(!static_cast<memgraph::storage::InMemoryStorage *>(main_store.get())
+                   ->RegisterReplica("REPLICA", kReplicaEndpoint, memgraph::storage::replication::ReplicationMode::SYNC,
+                                     memgraph::storage::replication::RegistrationMode::MUST_BE_INSTANTLY_VALID,
+                                     memgraph::storage::replication::ReplicationClientConfig{})
+                   .HasError());
+
+    const auto label = main_store->NameToLabel("label");
+    const auto property = main_store->NameToProperty("property");
+    const auto edge_type = main_store->NameToEdgeType("edge_type");
+    const auto num_vertices = state.range(0);
+    for (auto _ : state) {
+      auto acc = main_store->Access();
+      std::optional<memgraph::storage::VertexAccessor> previous;
+      for (int64_t i = 0; i < num_vertices; ++i) {
+        auto vertex = acc->CreateVertex();
+        MG_ASSERT(vertex.AddLabel(label).HasValue());
+        MG_ASSERT(vertex.SetProperty(property, memgraph::storage::PropertyValue(i)).HasValue());
+        if (previous) {
+          MG_ASSERT(acc->CreateEdge(&*previous, &vertex, edge_type).HasValue());
+        }
+        previous.emplace(vertex);
+      }
+      MG_ASSERT(!acc->Commit().HasError());
+    }
+    // Every vertex adds a create, a label, a property and an edge delta.
+    state.SetItemsProcessed(state.iterations() * num_vertices * 4);
+  }
+  std::filesystem::remove_all(kStorageDirectory);
+}
+
+BENCHMARK(ReplicaLag)->Arg(1)->Arg(100)->Arg(10'000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
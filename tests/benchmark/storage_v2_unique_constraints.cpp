@@ -0,0 +1,84 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "storage/v2/inmemory/storage.hpp"
+
+// Measures the commit throughput of concurrent writers which create vertices
+// with a label that has a unique constraint. Every vertex gets a few more
+// properties, so that it has several deltas like the vertices of real
+// transactions.
+
+namespace {
+
+constexpr int kNumWriters = 32;
+constexpr int64_t kNumProperties = 4;
+
+class UniqueConstraintsFixture : public benchmark::Fixture {
+ protected:
+  void SetUp(const benchmark::State &state) override {
+    if (state.thread_index() == 0) {
+      storage = std::make_unique<memgraph::storage::InMemoryStorage>();
+      label = storage->NameToLabel("Label");
+      for (int64_t i = 0; i < kNumProperties; ++i) {
+        properties[i] = storage->NameToProperty("property_" + std::to_string(i));
+      }
+      MG_ASSERT(!storage->CreateUniqueConstraint(label, {properties[0]}, {}).HasError());
+      next_value = 0;
+    }
+  }
+
+  void TearDown(const benchmark::State &state) override {
+    if (state.thread_index() == 0) {
+      storage.reset();
+    }
+  }
+
+  std::unique_ptr<memgraph::storage::Storage> storage;
+  memgraph::storage::LabelId label;
+  std::array<memgraph::storage::PropertyId, kNumProperties> properties;
+  std::atomic<int64_t> next_value{0};
+};
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(UniqueConstraintsFixture, Commit)(benchmark::State &state) {
+  const auto num_vertices = state.range(0);
+  for (auto _ : state) {
+    auto acc = storage->Access();
+    const auto first_value = next_value.fetch_add(num_vertices, std::memory_order_relaxed);
+    for (int64_t i = 0; i < num_vertices; ++i) {
+      auto vertex = acc->CreateVertex();
+      MG_ASSERT(vertex.AddLabel(label).HasValue());
+      for (int64_t j = 0; j < kNumProperties; ++j) {
+        MG_ASSERT(vertex.SetProperty(properties[j], memgraph::storage::PropertyValue(first_value + i)).HasValue());
+      }
+    }
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+  state.SetItemsProcessed(state.iterations() * num_vertices);
+}
+
+BENCHMARK_REGISTER_F(UniqueConstraintsFixture, Commit)
+    ->Arg(1)
+    ->Arg(1'000)
+    ->Threads(1)
+    ->Threads(kNumWriters)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -114,6 +114,11 @@ startup_config_dict = {
         "false",
         "Controls whether the index creation can be done in a multithreaded fashion.",
     ),
+    "storage_parallel_snapshot_creation": (
+        "false",
+        "false",
+        "Controls whether the snapshot creation can be done in a multithreaded fashion.",
+    ),
     "password_encryption_algorithm": ("bcrypt", "bcrypt", "The password encryption algorithm used for authentication."),
     "pulsar_service_url": ("", "", "Default URL used while connecting to Pulsar brokers."),
     "query_execution_timeout_sec": (
@@ -126,11 +131,36 @@ startup_config_dict = {
         "",
         "Directory where modules with custom query procedures are stored. NOTE: Multiple comma-separated directories can be defined.",
     ),
+    "query_parallel_scan_threads": (
+        "0",
+        "0",
+        "Number of threads used to scan and aggregate vertices of read-only queries on in-memory storage. Values of 0 and 1 disable parallel scans.",
+    ),
     "replication_replica_check_frequency_sec": (
         "1",
         "1",
         "The time duration between two replica checks/pings. If < 1, replicas will NOT be checked at all. NOTE: The MAIN instance allocates a new thread for each REPLICA.",
     ),
+    "storage_disk_block_cache_size_mib": (
+        "0",
+        "0",
+        "Size of the block cache shared by all of the on-disk storage RocksDB instances (in MiB). Set to 0 to use the RocksDB default cache of each instance.",
+    ),
+    "storage_disk_bloom_filter_bits_per_key": (
+        "10",
+        "10",
+        "Bits per key of the bloom filters of the on-disk storage. Set to 0 to disable the bloom filters.",
+    ),
+    "storage_disk_compression": (
+        "NONE",
+        "NONE",
+        "Compression of the on-disk storage data files. ZSTD also compresses the RocksDB WAL. Allowed values: NONE, LZ4, ZSTD",
+    ),
+    "storage_disk_use_direct_io": (
+        "false",
+        "false",
+        "Controls whether the on-disk storage bypasses the page cache for reads, flushes and compactions.",
+    ),
     "storage_gc_cycle_sec": ("30", "30", "Storage garbage collector interval (in seconds)."),
     "storage_items_per_batch": (
         "1000000",
@@ -138,6 +168,11 @@ startup_config_dict = {
         "The number of edges and vertices stored in a batch in a snapshot file.",
     ),
     "storage_properties_on_edges": ("false", "true", "Controls whether edges have properties."),
+    "storage_property_string_interning_max_length": (
+        "0",
+        "0",
+        "String property values of up to this many bytes are stored once in a shared dictionary instead of in every vertex and edge. Set to 0 to disable string interning.",
+    ),
     "storage_recovery_thread_count": ("12", "12", "The number of threads used to recover persisted data from disk."),
     "storage_snapshot_interval_sec": (
         "0",
@@ -146,6 +181,7 @@ startup_config_dict = {
     ),
     "storage_snapshot_on_exit": ("false", "false", "Controls whether the storage creates another snapshot on exit."),
     "storage_snapshot_retention_count": ("3", "3", "The number of snapshots that should always be kept."),
+    "storage_snapshot_thread_count": ("8", "8", "The number of threads used to create snapshots."),
     "storage_wal_enabled": (
         "false",
         "true",
@@ -156,6 +192,11 @@ startup_config_dict = {
         "100000",
         "Issue a 'fsync' call after this amount of transactions are written to the WAL file. Set to 1 for fully synchronous operation.",
     ),
+    "storage_wal_file_flush_interval_ms": (
+        "0",
+        "0",
+        "Issue a 'fsync' call at least this often (in milliseconds) if any transactions were written to the WAL file since the last one. The 'fsync' is shared by all transactions written in the meantime. Set to 0 to sync only based on --storage-wal-file-flush-every-n-tx.",
+    ),
     "storage_wal_file_size_kib": ("20480", "20480", "Minimum file size of each WAL file."),
     "storage_delete_on_drop": (
         "true",
@@ -172,6 +213,11 @@ startup_config_dict = {
         "500",
         "Retry interval in milliseconds when a stream transformation fails to commit because of conflicting transactions",
     ),
+    "stream_transformation_batching": (
+        "false",
+        "false",
+        "Set to true to execute consecutive queries with the same text returned by a stream transformation as a single query which unwinds their parameters. The queries are then parsed and planned once per batch, but the MATCH clauses of a query don't see the changes made for the previous rows of the same batch.",
+    ),
     "telemetry_enabled": (
         "false",
         "false",
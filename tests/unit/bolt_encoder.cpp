@@ -18,6 +18,7 @@
 #include "communication/bolt/v1/codes.hpp"
 #include "communication/bolt/v1/encoder/encoder.hpp"
 #include "disk_test_utils.hpp"
+#include "glue/bolt_encoder.hpp"
 #include "glue/communication.hpp"
 #include "storage/v2/disk/storage.hpp"
 #include "storage/v2/inmemory/storage.hpp"
@@ -540,3 +541,63 @@ TEST_F(BoltEncoder, LocalDateTime) {
   // clang-format on
   CheckOutput(output, expected.data(), expected.size());
 }
+
+TEST_F(BoltEncoder, TypedValueEncoderMatchesBoltValue) {
+  std::unique_ptr<memgraph::storage::Storage> db{new memgraph::storage::InMemoryStorage()};
+  auto dba = db->Access();
+  // Register the properties in reverse name order, so that their ids don't
+  // sort the same way as their names.
+  for (const auto *name : {"prop4", "prop3", "prop2", "prop1"}) dba->NameToProperty(name);
+  auto va1 = dba->CreateVertex();
+  auto va2 = dba->CreateVertex();
+  ASSERT_TRUE(va1.AddLabel(dba->NameToLabel("label1")).HasValue());
+  ASSERT_TRUE(va1.AddLabel(dba->NameToLabel("label2")).HasValue());
+  ASSERT_TRUE(va1.SetProperty(dba->NameToProperty("prop1"), memgraph::storage::PropertyValue(12)).HasValue());
+  ASSERT_TRUE(va1.SetProperty(dba->NameToProperty("prop2"), memgraph::storage::PropertyValue("value")).HasValue());
+  ASSERT_TRUE(va1.SetProperty(dba->NameToProperty("prop3"),
+                              memgraph::storage::PropertyValue(std::vector<memgraph::storage::PropertyValue>{
+                                  memgraph::storage::PropertyValue(1.5), memgraph::storage::PropertyValue(true)}))
+                  .HasValue());
+  auto ea = dba->CreateEdge(&va1, &va2, dba->NameToEdgeType("edgetype")).GetValue();
+  ASSERT_TRUE(ea.SetProperty(dba->NameToProperty("prop4"), memgraph::storage::PropertyValue(1234)).HasValue());
+  ASSERT_TRUE(ea.SetProperty(dba->NameToProperty("prop1"), memgraph::storage::PropertyValue("edge")).HasValue());
+
+  std::vector<memgraph::query::TypedValue> values;
+  values.emplace_back(memgraph::query::VertexAccessor(va1));
+  values.emplace_back(memgraph::query::VertexAccessor(va2));
+  values.emplace_back(memgraph::query::EdgeAccessor(ea));
+  values.emplace_back(std::vector<memgraph::query::TypedValue>{memgraph::query::TypedValue(),
+                                                               memgraph::query::TypedValue("string"),
+                                                               memgraph::query::TypedValue(-100000)});
+  values.emplace_back(std::map<std::string, memgraph::query::TypedValue>{
+      {"a", memgraph::query::TypedValue(memgraph::utils::Date({1994, 12, 7}))},
+      {"b", memgraph::query::TypedValue(memgraph::query::VertexAccessor(va1))}});
+
+  for (const auto version : {1, 4, 5}) {
+    for (const auto &value : values) {
+      memgraph::glue::BoltRecordBuffer expected;
+      memgraph::communication::bolt::BaseEncoder<memgraph::glue::BoltRecordBuffer> base_encoder(expected);
+      base_encoder.UpdateVersion(version);
+      base_encoder.WriteValue(*memgraph::glue::ToBoltValue(value, *db, memgraph::storage::View::NEW));
+
+      memgraph::glue::BoltRecordBuffer actual;
+      memgraph::glue::TypedValueEncoder<memgraph::glue::BoltRecordBuffer> typed_value_encoder(
+          actual, *db, memgraph::storage::View::NEW);
+      typed_value_encoder.UpdateVersion(version);
+      ASSERT_FALSE(typed_value_encoder.WriteTypedValue(value).HasError());
+
+      ASSERT_EQ(std::vector<uint8_t>(actual.data(), actual.data() + actual.size()),
+                std::vector<uint8_t>(expected.data(), expected.data() + expected.size()));
+    }
+  }
+
+  // Deleted objects are reported before anything is written.
+  ASSERT_TRUE(dba->DetachDeleteVertex(&va2).HasValue());
+  memgraph::glue::BoltRecordBuffer buffer;
+  memgraph::glue::TypedValueEncoder<memgraph::glue::BoltRecordBuffer> typed_value_encoder(
+      buffer, *db, memgraph::storage::View::NEW);
+  auto maybe_written = typed_value_encoder.WriteTypedValue(values[1]);
+  ASSERT_TRUE(maybe_written.HasError());
+  ASSERT_EQ(maybe_written.GetError(), memgraph::storage::Error::DELETED_OBJECT);
+  ASSERT_EQ(buffer.size(), 0);
+}
@@ -975,6 +975,36 @@ TYPED_TEST(PrintToJsonTest, Cartesian) {
           })sep");
 }
 
+TYPED_TEST(PrintToJsonTest, HashJoin) {
+  Symbol n = this->GetSymbol("n");
+  std::shared_ptr<LogicalOperator> lhs = std::make_shared<ScanAll>(nullptr, n);
+
+  Symbol m = this->GetSymbol("m");
+  std::shared_ptr<LogicalOperator> rhs = std::make_shared<ScanAll>(nullptr, m);
+
+  auto *condition = EQ(PROPERTY_LOOKUP(this->dba, "n", this->dba.NameToProperty("prop")), IDENT("m"));
+  std::shared_ptr<LogicalOperator> last_op =
+      std::make_shared<HashJoin>(lhs, std::vector<Symbol>{n}, rhs, std::vector<Symbol>{m}, condition);
+
+  this->Check(last_op.get(), R"sep(
+          {
+            "name" : "HashJoin",
+            "hash_join_condition" : "(== (PropertyLookup (Identifier \"n\") \"prop\") (Identifier \"m\"))",
+            "left_symbols" : ["n"],
+            "right_symbols" : ["m"],
+            "left_op" : {
+              "name" : "ScanAll",
+              "output_symbol" : "n",
+              "input" : { "name" : "Once" }
+            },
+            "right_op" : {
+              "name" : "ScanAll",
+              "output_symbol" : "m",
+              "input" : { "name" : "Once" }
+            }
+          })sep");
+}
+
 TYPED_TEST(PrintToJsonTest, CallProcedure) {
   memgraph::query::plan::CallProcedure call_op;
   call_op.input_ = std::make_shared<Once>();
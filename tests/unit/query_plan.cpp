@@ -691,8 +691,11 @@ TYPED_TEST(TestPlanner, MatchCrossReferenceVariable) {
   std::get<0>(node_m->properties_)[this->storage.GetPropertyIx(prop.first)] = n_prop;
   auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(node_n), PATTERN(node_m)), RETURN("n")));
   // We expect both ScanAll to come before filters (2 are joined into one),
-  // because they need to populate the symbol values.
-  CheckPlan<TypeParam>(query, this->storage, ExpectScanAll(), ExpectScanAll(), ExpectFilter(), ExpectProduce());
+  // because they need to populate the symbol values. The first equality is
+  // then used to hash join the 2 scans, while the other remains in the Filter.
+  std::list<BaseOpChecker *> left_plan{new ExpectScanAll()};
+  std::list<BaseOpChecker *> right_plan{new ExpectScanAll()};
+  CheckPlan<TypeParam>(query, this->storage, ExpectHashJoin(left_plan, right_plan), ExpectFilter(), ExpectProduce());
 }
 
 TYPED_TEST(TestPlanner, MatchWhereBeforeExpand) {
@@ -1177,6 +1180,41 @@ TYPED_TEST(TestPlanner, SecondPropertyIndex) {
             ExpectScanAllByLabelPropertyValue(label, property, n_prop), ExpectProduce());
 }
 
+TYPED_TEST(TestPlanner, MatchHashJoin) {
+  // Test MATCH (n :label), (m :label) WHERE n.property = m.property RETURN n
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto property = PROPERTY_PAIR(dba, "property");
+  dba.SetIndexCount(label, 0);
+  auto *query = QUERY(
+      SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label")), PATTERN(NODE("m", "label"))),
+                   WHERE(EQ(PROPERTY_LOOKUP(dba, "n", property), PROPERTY_LOOKUP(dba, "m", property))), RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  // There is no index on the property, so the scans are joined by hashing.
+  std::list<BaseOpChecker *> left_plan{new ExpectScanAllByLabel()};
+  std::list<BaseOpChecker *> right_plan{new ExpectScanAllByLabel()};
+  CheckPlan(planner.plan(), symbol_table, ExpectHashJoin(left_plan, right_plan), ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, MatchHashJoinNotUsedWithPropertyIndex) {
+  // Test MATCH (n :label), (m :label) WHERE n.property = m.property RETURN n
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto property = PROPERTY_PAIR(dba, "property");
+  dba.SetIndexCount(label, 0);
+  dba.SetIndexCount(label, dba.Property("property"), 0);
+  auto n_prop = PROPERTY_LOOKUP(dba, "n", property);
+  auto m_prop = PROPERTY_LOOKUP(dba, "m", property);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label")), PATTERN(NODE("m", "label"))),
+                                   WHERE(EQ(n_prop, m_prop)), RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  // The indexed lookup uses n, so m can't be scanned independently.
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabel(),
+            ExpectScanAllByLabelPropertyValue(label, property, n_prop), ExpectProduce());
+}
+
 TYPED_TEST(TestPlanner, ReturnSumGroupByAll) {
   // Test RETURN sum([1,2,3]), all(x in [1] where x = 1)
   auto sum = SUM(LIST(LITERAL(1), LITERAL(2), LITERAL(3)), false);
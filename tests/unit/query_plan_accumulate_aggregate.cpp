@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <iterator>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "disk_test_utils.hpp"
@@ -409,6 +410,217 @@ TYPED_TEST(QueryPlanTest, AggregateMultipleGroupBy) {
   EXPECT_EQ(results.size(), 2 * 3 * 5);
 }
 
+TYPED_TEST(QueryPlanTest, AggregateSingleGroupByKey) {
+  // COUNT, SUM and AVG grouped by a single integer or string key are aggregated
+  // in a flat table until a key of another type (here a double) shows up, after
+  // which the groups continue in the generic aggregation.
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  auto key = dba.NameToProperty("key");
+  auto value = dba.NameToProperty("value");
+  auto add_vertex = [&](const memgraph::storage::PropertyValue &key_value,
+                        const memgraph::storage::PropertyValue &value_value) {
+    auto v = dba.InsertVertex();
+    ASSERT_TRUE(v.SetProperty(key, key_value).HasValue());
+    ASSERT_TRUE(v.SetProperty(value, value_value).HasValue());
+  };
+  for (int i = 0; i < 30; ++i) {
+    add_vertex(memgraph::storage::PropertyValue(i % 3), memgraph::storage::PropertyValue(i));
+  }
+  add_vertex(memgraph::storage::PropertyValue("three"), memgraph::storage::PropertyValue(0.5));
+  add_vertex(memgraph::storage::PropertyValue("three"), memgraph::storage::PropertyValue(2));
+  add_vertex(memgraph::storage::PropertyValue(0), memgraph::storage::PropertyValue());
+  add_vertex(memgraph::storage::PropertyValue(2.0), memgraph::storage::PropertyValue(100));
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto n_key = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), key);
+  auto n_value = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), value);
+  auto produce = this->MakeAggregationProduce(
+      n.op_, symbol_table, {nullptr, n_value, n_value, n_value},
+      {Aggregation::Op::COUNT, Aggregation::Op::COUNT, Aggregation::Op::SUM, Aggregation::Op::AVG}, {n_key}, {n.sym_},
+      false);
+
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  auto results = CollectProduce(*produce, &context);
+  ASSERT_EQ(results.size(), 4);
+  std::unordered_map<TypedValue, std::vector<TypedValue>, TypedValue::Hash, TypedValue::BoolEqual> groups;
+  for (const auto &row : results) {
+    ASSERT_EQ(row.size(), 5);
+    groups.emplace(row[4], row);
+  }
+
+  const auto &group0 = groups.at(TypedValue(0));
+  EXPECT_EQ(group0[0].ValueInt(), 11);
+  EXPECT_EQ(group0[1].ValueInt(), 10);
+  EXPECT_EQ(group0[2].ValueInt(), 135);
+  EXPECT_DOUBLE_EQ(group0[3].ValueDouble(), 13.5);
+
+  const auto &group1 = groups.at(TypedValue(1));
+  EXPECT_EQ(group1[0].ValueInt(), 10);
+  EXPECT_EQ(group1[2].ValueInt(), 145);
+  EXPECT_DOUBLE_EQ(group1[3].ValueDouble(), 14.5);
+
+  const auto &group2 = groups.at(TypedValue(2));
+  EXPECT_EQ(group2[0].ValueInt(), 11);
+  EXPECT_EQ(group2[2].ValueInt(), 255);
+  EXPECT_DOUBLE_EQ(group2[3].ValueDouble(), 255.0 / 11);
+
+  const auto &group_three = groups.at(TypedValue("three"));
+  EXPECT_EQ(group_three[0].ValueInt(), 2);
+  EXPECT_DOUBLE_EQ(group_three[2].ValueDouble(), 2.5);
+  EXPECT_DOUBLE_EQ(group_three[3].ValueDouble(), 1.25);
+}
+
+TYPED_TEST(QueryPlanTest, AggregateSingleGroupByKeyAcrossPulls) {
+  // The groups of the flat aggregation are kept between pulls, so they mustn't
+  // be allocated from the memory of a single pull.
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  auto key = dba.NameToProperty("key");
+  for (int i = 0; i < 30; ++i) {
+    auto v = dba.InsertVertex();
+    ASSERT_TRUE(v.SetProperty(key, memgraph::storage::PropertyValue(i % 10)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto n_key = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), key);
+  auto produce = this->MakeAggregationProduce(n.op_, symbol_table, {nullptr}, {Aggregation::Op::COUNT}, {n_key},
+                                              {n.sym_}, false);
+  std::vector<Symbol> symbols;
+  for (auto *named_expression : produce->named_expressions_) symbols.emplace_back(symbol_table.at(*named_expression));
+
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  Frame frame(symbol_table.max_position());
+  auto cursor = produce->MakeCursor(memgraph::utils::NewDeleteResource());
+  std::unordered_map<int64_t, int64_t> counts;
+  while (true) {
+    memgraph::utils::MonotonicBufferResource pull_memory(1024);
+    context.evaluation_context.memory = &pull_memory;
+    if (!cursor->Pull(frame, context)) break;
+    ASSERT_EQ(symbols.size(), 2);
+    counts.emplace(frame[symbols[1]].ValueInt(), frame[symbols[0]].ValueInt());
+  }
+  context.evaluation_context.memory = memgraph::utils::NewDeleteResource();
+
+  ASSERT_EQ(counts.size(), 10);
+  for (const auto &[group, count] : counts) EXPECT_EQ(count, 3) << "group " << group;
+}
+
+TYPED_TEST(QueryPlanTest, AggregateParallelScan) {
+  // A filtered label scan below an Aggregate is split into morsels which are
+  // aggregated on multiple threads. The merged partial aggregations have to
+  // match the serial execution.
+  auto label = this->db->NameToLabel("label");
+  [[maybe_unused]] auto _ = this->db->CreateIndex(label);
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  auto key = dba.NameToProperty("key");
+  auto value = dba.NameToProperty("value");
+  for (int i = 0; i < 25'000; ++i) {
+    auto v = dba.InsertVertex();
+    if (i % 10 != 0) ASSERT_TRUE(v.AddLabel(label).HasValue());
+    ASSERT_TRUE(v.SetProperty(key, memgraph::storage::PropertyValue(i % 4)).HasValue());
+    if (i % 7 != 0) ASSERT_TRUE(v.SetProperty(value, memgraph::storage::PropertyValue(i)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  auto collect = [&](uint64_t parallel_scan_threads) {
+    SymbolTable symbol_table;
+    auto n = MakeScanAllByLabel(this->storage, symbol_table, "n", label);
+    auto n_key = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), key);
+    auto n_value = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), value);
+    auto filter = std::make_shared<Filter>(n.op_, std::vector<std::shared_ptr<LogicalOperator>>{},
+                                           LESS(PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), key), LITERAL(3)));
+    auto produce = this->MakeAggregationProduce(filter, symbol_table, {nullptr, n_value, n_value, n_value, n_value},
+                                                {Aggregation::Op::COUNT, Aggregation::Op::SUM, Aggregation::Op::AVG,
+                                                 Aggregation::Op::MIN, Aggregation::Op::MAX},
+                                                {n_key}, {}, false);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    // The interpreter scans in parallel only on in-memory storage.
+    if (std::is_same<TypeParam, memgraph::storage::InMemoryStorage>::value) {
+      context.parallel_scan_threads = parallel_scan_threads;
+    }
+    auto results = CollectProduce(*produce, &context);
+    std::sort(results.begin(), results.end(),
+              [](const auto &lhs, const auto &rhs) { return lhs[5].ValueInt() < rhs[5].ValueInt(); });
+    return results;
+  };
+
+  auto serial = collect(0);
+  auto parallel = collect(4);
+  ASSERT_EQ(serial.size(), 3);
+  ASSERT_EQ(parallel.size(), serial.size());
+  int64_t total_count = 0;
+  for (size_t i = 0; i < serial.size(); ++i) {
+    ASSERT_EQ(parallel[i].size(), 6);
+    EXPECT_EQ(parallel[i][0].ValueInt(), serial[i][0].ValueInt());
+    EXPECT_EQ(parallel[i][1].ValueInt(), serial[i][1].ValueInt());
+    EXPECT_DOUBLE_EQ(parallel[i][2].ValueDouble(), serial[i][2].ValueDouble());
+    EXPECT_EQ(parallel[i][3].ValueInt(), serial[i][3].ValueInt());
+    EXPECT_EQ(parallel[i][4].ValueInt(), serial[i][4].ValueInt());
+    EXPECT_EQ(parallel[i][5].ValueInt(), serial[i][5].ValueInt());
+    total_count += parallel[i][0].ValueInt();
+  }
+  // 18'750 vertices have a key below 3, 2'500 of them don't have the label.
+  EXPECT_EQ(total_count, 16'250);
+}
+
+TYPED_TEST(QueryPlanTest, AggregateParallelScanGroupByVertex) {
+  // The threads of a parallel scan read through their own transactions. The
+  // grouped vertices have to stay usable after the threads are finished.
+  if (!std::is_same<TypeParam, memgraph::storage::InMemoryStorage>::value) return;
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  auto value = dba.NameToProperty("value");
+  for (int i = 0; i < 25'000; ++i) {
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(value, memgraph::storage::PropertyValue(i)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto produce = this->MakeAggregationProduce(n.op_, symbol_table, {nullptr}, {Aggregation::Op::COUNT},
+                                              {IDENT("n")->MapTo(n.sym_)}, {}, false);
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  context.parallel_scan_threads = 4;
+  auto results = CollectProduce(*produce, &context);
+  ASSERT_EQ(results.size(), 25'000);
+  int64_t sum = 0;
+  for (const auto &row : results) {
+    EXPECT_EQ(row[0].ValueInt(), 1);
+    sum += row[1].ValueVertex().GetProperty(memgraph::storage::View::OLD, value)->ValueInt();
+  }
+  EXPECT_EQ(sum, int64_t{25'000} * 24'999 / 2);
+}
+
+TYPED_TEST(QueryPlanTest, AggregateParallelScanMemoryLimit) {
+  // The threads of a parallel scan allocate from the memory of the query, so
+  // they are subject to its limit.
+  if (!std::is_same<TypeParam, memgraph::storage::InMemoryStorage>::value) return;
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  for (int i = 0; i < 25'000; ++i) dba.InsertVertex();
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto produce = this->MakeAggregationProduce(n.op_, symbol_table, {nullptr}, {Aggregation::Op::COUNT}, {}, {}, false);
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  context.parallel_scan_threads = 4;
+  memgraph::utils::LimitedMemoryResource limited_memory(memgraph::utils::NewDeleteResource(), 1024);
+  context.evaluation_context.memory = &limited_memory;
+  EXPECT_THROW(CollectProduce(*produce, &context), memgraph::utils::BadAlloc);
+}
+
 TYPED_TEST(QueryPlanTest, AggregateNoInput) {
   auto storage_dba = this->db->Access();
   memgraph::query::DbAccessor dba(storage_dba.get());
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <iterator>
 #include <memory>
+#include <numeric>
 #include <vector>
 
 #include "disk_test_utils.hpp"
@@ -255,6 +256,48 @@ TYPED_TEST(QueryPlanTest, OrderByMultiple) {
   }
 }
 
+TYPED_TEST(QueryPlanTest, OrderByTopK) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  SymbolTable symbol_table;
+  auto prop = dba.NameToProperty("prop");
+
+  const int N = 100;
+  std::vector<int> prop_values(N);
+  std::iota(prop_values.begin(), prop_values.end(), 0);
+  std::random_shuffle(prop_values.begin(), prop_values.end());
+  for (const auto value : prop_values)
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(prop, memgraph::storage::PropertyValue(value)).HasValue());
+  dba.AdvanceCommand();
+
+  // MATCH (n) RETURN n.prop ORDER BY n.prop DESC SKIP skip LIMIT limit
+  auto check_top_k = [&](int64_t skip, int64_t limit) {
+    auto n = MakeScanAll(this->storage, symbol_table, "n");
+    auto n_p = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), prop);
+    auto order_by = std::make_shared<plan::OrderBy>(n.op_, std::vector<SortItem>{{Ordering::DESC, n_p}},
+                                                    std::vector<Symbol>{n.sym_});
+    order_by->skip_ = LITERAL(skip);
+    order_by->limit_ = LITERAL(limit);
+    auto skip_op = std::make_shared<plan::Skip>(order_by, LITERAL(skip));
+    auto limit_op = std::make_shared<plan::Limit>(skip_op, LITERAL(limit));
+    auto n_p_ne = NEXPR("n.p", n_p)->MapTo(symbol_table.CreateSymbol("n.p", true));
+    auto produce = MakeProduce(limit_op, n_p_ne);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    auto results = CollectProduce(*produce, &context);
+    ASSERT_EQ(std::min<int64_t>(limit, std::max<int64_t>(N - skip, 0)), results.size());
+    for (int j = 0; j < results.size(); ++j) {
+      ASSERT_EQ(results[j][0].type(), TypedValue::Type::Int);
+      EXPECT_EQ(results[j][0].ValueInt(), N - 1 - skip - j);
+    }
+  };
+  check_top_k(0, 10);
+  check_top_k(5, 10);
+  check_top_k(95, 10);
+  check_top_k(0, N);
+  check_top_k(0, 2 * N);
+  check_top_k(N, 1);
+}
+
 TYPED_TEST(QueryPlanTest, OrderByExceptions) {
   auto storage_dba = this->db->Access();
   memgraph::query::DbAccessor dba(storage_dba.get());
@@ -484,6 +484,77 @@ TYPED_TEST(QueryPlan, CartesianThreeWay) {
   }
 }
 
+TYPED_TEST(QueryPlan, HashJoin) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto property = PROPERTY_PAIR(dba, "property");
+
+  auto add_vertex = [&dba, &property](std::optional<memgraph::storage::PropertyValue> value) {
+    auto vertex = dba.InsertVertex();
+    if (value) {
+      MG_ASSERT(vertex.SetProperty(property.second, *value).HasValue());
+    }
+    return vertex;
+  };
+
+  // Int and double values which compare equal have to be joined, while
+  // vertices without the property (null) never match anything.
+  add_vertex(memgraph::storage::PropertyValue(1));
+  add_vertex(memgraph::storage::PropertyValue(1));
+  add_vertex(memgraph::storage::PropertyValue(2));
+  add_vertex(memgraph::storage::PropertyValue(2.0));
+  add_vertex(memgraph::storage::PropertyValue("1"));
+  add_vertex(std::nullopt);
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto m = MakeScanAll(this->storage, symbol_table, "m");
+  auto *condition = EQ(PROPERTY_LOOKUP(dba, n.node_->identifier_, property),
+                       PROPERTY_LOOKUP(dba, m.node_->identifier_, property));
+  auto return_n = NEXPR("n", IDENT("n")->MapTo(n.sym_))->MapTo(symbol_table.CreateSymbol("named_expression_1", true));
+  auto return_m = NEXPR("m", IDENT("m")->MapTo(m.sym_))->MapTo(symbol_table.CreateSymbol("named_expression_2", true));
+
+  std::vector<Symbol> left_symbols{n.sym_};
+  std::vector<Symbol> right_symbols{m.sym_};
+  auto hash_join_op = std::make_shared<HashJoin>(n.op_, left_symbols, m.op_, right_symbols, condition);
+
+  auto produce = MakeProduce(hash_join_op, return_n, return_m);
+
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  auto results = CollectProduce(*produce, &context);
+  // 2 * 2 pairs with the value 1, 2 * 2 pairs with the value 2 and a single
+  // pair with the value "1".
+  ASSERT_EQ(results.size(), 9);
+  for (const auto &row : results) {
+    auto n_value = row[0].ValueVertex().GetProperty(memgraph::storage::View::OLD, property.second).GetValue();
+    auto m_value = row[1].ValueVertex().GetProperty(memgraph::storage::View::OLD, property.second).GetValue();
+    EXPECT_TRUE((memgraph::query::TypedValue(n_value) == memgraph::query::TypedValue(m_value)).ValueBool());
+  }
+}
+
+TYPED_TEST(QueryPlan, HashJoinEmptySet) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto property = PROPERTY_PAIR(dba, "property");
+  SymbolTable symbol_table;
+
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto m = MakeScanAll(this->storage, symbol_table, "m");
+  auto *condition = EQ(PROPERTY_LOOKUP(dba, n.node_->identifier_, property),
+                       PROPERTY_LOOKUP(dba, m.node_->identifier_, property));
+  auto return_n = NEXPR("n", IDENT("n")->MapTo(n.sym_))->MapTo(symbol_table.CreateSymbol("named_expression_1", true));
+
+  std::vector<Symbol> left_symbols{n.sym_};
+  std::vector<Symbol> right_symbols{m.sym_};
+  auto hash_join_op = std::make_shared<HashJoin>(n.op_, left_symbols, m.op_, right_symbols, condition);
+
+  auto produce = MakeProduce(hash_join_op, return_n);
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  EXPECT_EQ(PullAll(*produce, &context), 0);
+}
+
 template <typename StorageType>
 class ExpandFixture : public testing::Test {
  protected:
@@ -1784,6 +1855,117 @@ TYPED_TEST(QueryPlanExpandVariable, FineGrainedExpandToSameSymbol) {
 }
 #endif
 
+/** A test fixture for s-t shortest path expansion, that is breadth-first
+ * expansion between two existing nodes */
+template <typename StorageType>
+class QueryPlanExpandSTShortestPath : public testing::Test {
+ protected:
+  memgraph::storage::Config config = disk_test_utils::GenerateOnDiskConfig(testSuite);
+  std::unique_ptr<memgraph::storage::Storage> db{new StorageType(config)};
+  std::unique_ptr<memgraph::storage::Storage::Accessor> storage_dba{db->Access()};
+  memgraph::query::DbAccessor dba{storage_dba.get()};
+  std::pair<std::string, memgraph::storage::PropertyId> prop = PROPERTY_PAIR(dba, "property");
+  memgraph::storage::EdgeTypeId edge_type = dba.NameToEdgeType("edge_type");
+
+  std::vector<memgraph::query::VertexAccessor> v;
+
+  AstStorage storage;
+  SymbolTable symbol_table;
+
+  void SetUp() override {
+    memgraph::license::global_license_checker.EnableTesting();
+
+    for (int i = 0; i < 12; i++) {
+      v.push_back(dba.InsertVertex());
+      ASSERT_TRUE(v.back().SetProperty(prop.second, memgraph::storage::PropertyValue(i)).HasValue());
+    }
+
+    auto add_edge = [&](int from, int to) { ASSERT_TRUE(dba.InsertEdge(&v[from], &v[to], edge_type).HasValue()); };
+
+    add_edge(0, 1);
+    add_edge(1, 2);
+    add_edge(2, 3);
+    for (int i = 4; i < 7; i++) add_edge(0, i);
+    for (int i = 7; i < 12; i++) add_edge(i, 3);
+
+    dba.AdvanceCommand();
+  }
+
+  void TearDown() override {
+    if (std::is_same<StorageType, memgraph::storage::DiskStorage>::value) {
+      disk_test_utils::RemoveRocksDbDirs(testSuite);
+    }
+  }
+
+  // Expands from the node with the `from` property value to the node with the
+  // `to` property value and returns the (from, to) property values of the
+  // edges of each found path, in path order.
+  std::vector<std::vector<std::pair<int64_t, int64_t>>> ExpandSTShortest(int from, int to,
+                                                                         EdgeAtom::Direction direction) {
+    auto n = MakeScanAll(storage, symbol_table, "n");
+    auto last_op = std::make_shared<Filter>(n.op_, std::vector<std::shared_ptr<LogicalOperator>>{},
+                                            EQ(PROPERTY_LOOKUP(dba, n.node_->identifier_, prop), LITERAL(from)));
+    auto m = MakeScanAll(storage, symbol_table, "m", last_op);
+    last_op = std::make_shared<Filter>(m.op_, std::vector<std::shared_ptr<LogicalOperator>>{},
+                                       EQ(PROPERTY_LOOKUP(dba, m.node_->identifier_, prop), LITERAL(to)));
+
+    auto edge_list_sym = symbol_table.CreateSymbol("edgelist_", true);
+    auto expand = std::make_shared<ExpandVariable>(
+        last_op, n.sym_, m.sym_, edge_list_sym, EdgeAtom::Type::BREADTH_FIRST, direction,
+        std::vector<memgraph::storage::EdgeTypeId>{}, false, nullptr, nullptr, /* existing = */ true,
+        ExpansionLambda{symbol_table.CreateSymbol("inner_edge", false), symbol_table.CreateSymbol("inner_node", false),
+                        nullptr},
+        std::nullopt, std::nullopt);
+
+    Frame frame(symbol_table.max_position());
+    auto cursor = expand->MakeCursor(memgraph::utils::NewDeleteResource());
+    auto context = MakeContext(storage, symbol_table, &dba);
+    std::vector<std::vector<std::pair<int64_t, int64_t>>> results;
+    while (cursor->Pull(frame, context)) {
+      auto &path = results.emplace_back();
+      for (const TypedValue &edge : frame[edge_list_sym].ValueList()) {
+        path.emplace_back(GetProp(edge.ValueEdge().From()), GetProp(edge.ValueEdge().To()));
+      }
+    }
+    return results;
+  }
+
+  int64_t GetProp(const memgraph::query::VertexAccessor &vertex) {
+    return vertex.GetProperty(memgraph::storage::View::OLD, prop.second)->ValueInt();
+  }
+};
+
+using StorageTypes = ::testing::Types<memgraph::storage::InMemoryStorage, memgraph::storage::DiskStorage>;
+TYPED_TEST_CASE(QueryPlanExpandSTShortestPath, StorageTypes);
+
+// The shortest path from [0] to [3] is [0]->[1]->[2]->[3]. [0] has three more
+// outgoing edges and [3] has five more incoming edges:
+//
+//  [4] [5] [6]   [7] .. [11]
+//    ^  ^  ^       \    /
+//     \ | /         v  v
+//      [0]->[1]->[2]->[3]
+//
+// Expanding from [0] first gives the bigger frontier, so the sink side is
+// expanded next. That gives the frontier of [3] which is bigger still, so the
+// source side is expanded again and meets the sink side in [2].
+TYPED_TEST(QueryPlanExpandSTShortestPath, AsymmetricFrontiers) {
+  using EdgeList = std::vector<std::pair<int64_t, int64_t>>;
+
+  EXPECT_THAT(this->ExpandSTShortest(0, 3, EdgeAtom::Direction::OUT),
+              testing::ElementsAre(EdgeList{{0, 1}, {1, 2}, {2, 3}}));
+  EXPECT_THAT(this->ExpandSTShortest(3, 0, EdgeAtom::Direction::OUT), testing::IsEmpty());
+  // Edges are listed from the source, so reversing the direction reverses the
+  // path but not the edges.
+  EXPECT_THAT(this->ExpandSTShortest(3, 0, EdgeAtom::Direction::IN),
+              testing::ElementsAre(EdgeList{{2, 3}, {1, 2}, {0, 1}}));
+  EXPECT_THAT(this->ExpandSTShortest(0, 3, EdgeAtom::Direction::IN), testing::IsEmpty());
+  EXPECT_THAT(this->ExpandSTShortest(0, 3, EdgeAtom::Direction::BOTH),
+              testing::ElementsAre(EdgeList{{0, 1}, {1, 2}, {2, 3}}));
+  EXPECT_THAT(this->ExpandSTShortest(3, 0, EdgeAtom::Direction::BOTH),
+              testing::ElementsAre(EdgeList{{2, 3}, {1, 2}, {0, 1}}));
+}
+
 namespace std {
 template <>
 struct hash<std::pair<int, int>> {
@@ -3002,6 +3184,70 @@ TYPED_TEST(QueryPlan, Filter) {
   EXPECT_EQ(CollectProduce(*produce, &context).size(), 2);
 }
 
+TYPED_TEST(QueryPlan, PullBatch) {
+  // MATCH (n)-[r]->(m) WHERE n.prop < 7 AND 2 <> n.prop RETURN n, m
+  // pulled in small batches has to return the same rows as pulled one row at
+  // a time.
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  auto property = PROPERTY_PAIR(dba, "prop");
+  auto edge_type = dba.NameToEdgeType("et");
+  std::vector<memgraph::query::VertexAccessor> vertices;
+  for (int i = 0; i < 10; ++i) {
+    auto v = dba.InsertVertex();
+    // The last vertex has no property, which compares as Null.
+    if (i < 9) ASSERT_TRUE(v.SetProperty(property.second, memgraph::storage::PropertyValue(i)).HasValue());
+    vertices.push_back(v);
+  }
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(dba.InsertEdge(&vertices[i], &vertices[(i + 1) % 10], edge_type).HasValue());
+  }
+  ASSERT_TRUE(dba.InsertEdge(&vertices[0], &vertices[0], edge_type).HasValue());
+  ASSERT_TRUE(dba.InsertEdge(&vertices[3], &vertices[5], edge_type).HasValue());
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto filter = std::make_shared<Filter>(
+      n.op_, std::vector<std::shared_ptr<LogicalOperator>>{},
+      AND(LESS(PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), property), LITERAL(7)),
+          NEQ(LITERAL(2), PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), property))));
+  auto r_m = MakeExpand(this->storage, symbol_table, filter, n.sym_, "r", EdgeAtom::Direction::OUT, {}, "m", false,
+                        memgraph::storage::View::OLD);
+  auto output_n = NEXPR("n", IDENT("n")->MapTo(n.sym_))->MapTo(symbol_table.CreateSymbol("named_expression_1", true));
+  auto output_m =
+      NEXPR("m", IDENT("m")->MapTo(r_m.node_sym_))->MapTo(symbol_table.CreateSymbol("named_expression_2", true));
+  auto produce = MakeProduce(r_m.op_, output_n, output_m);
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+
+  auto to_row = [&](const Frame &frame) {
+    return std::make_pair(frame[symbol_table.at(*output_n)].ValueVertex().Gid(),
+                          frame[symbol_table.at(*output_m)].ValueVertex().Gid());
+  };
+
+  std::vector<std::pair<memgraph::storage::Gid, memgraph::storage::Gid>> expected;
+  {
+    Frame frame(symbol_table.max_position());
+    auto cursor = produce->MakeCursor(memgraph::utils::NewDeleteResource());
+    while (cursor->Pull(frame, context)) expected.push_back(to_row(frame));
+  }
+  // Vertices 0 to 6 without 2, where 0 and 3 have two outgoing edges.
+  ASSERT_EQ(expected.size(), 8);
+
+  std::vector<std::pair<memgraph::storage::Gid, memgraph::storage::Gid>> batched;
+  {
+    Frame frame(symbol_table.max_position());
+    FrameBatch batch(symbol_table.max_position(), memgraph::utils::NewDeleteResource(), 3);
+    auto cursor = produce->MakeCursor(memgraph::utils::NewDeleteResource());
+    while (cursor->PullBatch(frame, batch, context)) {
+      ASSERT_LE(batch.size(), 3);
+      for (size_t row = 0; row < batch.size(); ++row) batched.push_back(to_row(batch[row]));
+    }
+  }
+  EXPECT_EQ(batched, expected);
+}
+
 TYPED_TEST(QueryPlan, EdgeUniquenessFilter) {
   auto storage_dba = this->db->Access();
   memgraph::query::DbAccessor dba(storage_dba.get());
@@ -12,7 +12,9 @@
 #include <algorithm>
 #include <iterator>
 #include <list>
+#include <map>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include <gmock/gmock.h>
@@ -77,11 +79,20 @@ struct MgpValueDeleter {
   }
 };
 
+struct MgpCsrGraphDeleter {
+  void operator()(mgp_csr_graph *csr) {
+    if (csr != nullptr) {
+      mgp_csr_graph_destroy(csr);
+    }
+  }
+};
+
 using MgpEdgePtr = std::unique_ptr<mgp_edge, MgpEdgeDeleter>;
 using MgpEdgesIteratorPtr = std::unique_ptr<mgp_edges_iterator, MgpEdgesIteratorDeleter>;
 using MgpVertexPtr = std::unique_ptr<mgp_vertex, MgpVertexDeleter>;
 using MgpVerticesIteratorPtr = std::unique_ptr<mgp_vertices_iterator, MgpVerticesIteratorDeleter>;
 using MgpValuePtr = std::unique_ptr<mgp_value, MgpValueDeleter>;
+using MgpCsrGraphPtr = std::unique_ptr<mgp_csr_graph, MgpCsrGraphDeleter>;
 
 template <typename TMaybeIterable>
 size_t CountMaybeIterables(TMaybeIterable &&maybe_iterable) {
@@ -694,3 +705,74 @@ TYPED_TEST(MgpGraphTest, EdgeSetPropertyWithImmutableGraph) {
   EXPECT_EQ(EXPECT_MGP_NO_ERROR(int, mgp_edge_underlying_graph_is_mutable, edge.get()), 0);
   EXPECT_EQ(mgp_edge_set_property(edge.get(), "property", value.get()), mgp_error::MGP_ERROR_IMMUTABLE_OBJECT);
 }
+
+TYPED_TEST(MgpGraphTest, ProjectCsr) {
+  std::array<int64_t, 3> vertex_ids{};
+  {
+    auto &accessor = this->CreateDbAccessor(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+    std::vector<memgraph::query::VertexAccessor> vertices;
+    for (auto i = 0; i < 3; ++i) {
+      vertices.push_back(accessor.InsertVertex());
+      vertex_ids[i] = vertices.back().Gid().AsInt();
+    }
+    ASSERT_TRUE(vertices[0].AddLabel(accessor.NameToLabel("Node")).HasValue());
+    ASSERT_TRUE(vertices[1].AddLabel(accessor.NameToLabel("Node")).HasValue());
+    const auto edge_type = accessor.NameToEdgeType("EDGE");
+    const auto weight = accessor.NameToProperty("weight");
+    auto first = accessor.InsertEdge(&vertices[0], &vertices[1], edge_type);
+    ASSERT_TRUE(first.HasValue());
+    ASSERT_TRUE(first->SetProperty(weight, memgraph::storage::PropertyValue(2)).HasValue());
+    auto second = accessor.InsertEdge(&vertices[1], &vertices[0], edge_type);
+    ASSERT_TRUE(second.HasValue());
+    ASSERT_TRUE(second->SetProperty(weight, memgraph::storage::PropertyValue(0.5)).HasValue());
+    ASSERT_TRUE(accessor.InsertEdge(&vertices[0], &vertices[2], edge_type).HasValue());
+    ASSERT_TRUE(accessor.InsertEdge(&vertices[1], &vertices[1], accessor.NameToEdgeType("OTHER")).HasValue());
+    ASSERT_FALSE(accessor.Commit().HasError());
+  }
+
+  auto graph = this->CreateGraph(memgraph::storage::View::OLD);
+  auto read_edges = [](mgp_csr_graph *csr) {
+    const auto vertex_count = EXPECT_MGP_NO_ERROR(size_t, mgp_csr_graph_vertex_count, csr);
+    const auto *ids = EXPECT_MGP_NO_ERROR(const int64_t *, mgp_csr_graph_vertex_ids, csr);
+    const auto *offsets = EXPECT_MGP_NO_ERROR(const size_t *, mgp_csr_graph_offsets, csr);
+    const auto *neighbors = EXPECT_MGP_NO_ERROR(const size_t *, mgp_csr_graph_neighbors, csr);
+    const auto *weights = EXPECT_MGP_NO_ERROR(const double *, mgp_csr_graph_weights, csr);
+    std::map<std::pair<int64_t, int64_t>, double> edges;
+    for (size_t i = 0; i < vertex_count; ++i) {
+      for (auto j = offsets[i]; j < offsets[i + 1]; ++j) {
+        edges.emplace(std::make_pair(ids[i], ids[neighbors[j]]), weights ? weights[j] : 0.0);
+      }
+    }
+    EXPECT_EQ(edges.size(), EXPECT_MGP_NO_ERROR(size_t, mgp_csr_graph_edge_count, csr));
+    return edges;
+  };
+  {
+    SCOPED_TRACE("Filtered by label and edge type, with weights");
+    MgpCsrGraphPtr csr{EXPECT_MGP_NO_ERROR(mgp_csr_graph *, mgp_graph_project_csr, &graph, "Node", "EDGE", "weight",
+                                           1.0, &this->memory)};
+    ASSERT_NE(csr, nullptr);
+    EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_csr_graph_vertex_count, csr.get()), 2);
+    const std::map<std::pair<int64_t, int64_t>, double> expected{{{vertex_ids[0], vertex_ids[1]}, 2.0},
+                                                                 {{vertex_ids[1], vertex_ids[0]}, 0.5}};
+    EXPECT_EQ(read_edges(csr.get()), expected);
+
+    // The same projection of an immutable graph is built only once.
+    MgpCsrGraphPtr cached{EXPECT_MGP_NO_ERROR(mgp_csr_graph *, mgp_graph_project_csr, &graph, "Node", "EDGE",
+                                              "weight", 1.0, &this->memory)};
+    ASSERT_NE(cached, nullptr);
+    EXPECT_EQ(EXPECT_MGP_NO_ERROR(const size_t *, mgp_csr_graph_neighbors, cached.get()),
+              EXPECT_MGP_NO_ERROR(const size_t *, mgp_csr_graph_neighbors, csr.get()));
+  }
+  {
+    SCOPED_TRACE("Filtered by edge type, without weights");
+    MgpCsrGraphPtr csr{EXPECT_MGP_NO_ERROR(mgp_csr_graph *, mgp_graph_project_csr, &graph, nullptr, "EDGE", nullptr,
+                                           1.0, &this->memory)};
+    ASSERT_NE(csr, nullptr);
+    EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_csr_graph_vertex_count, csr.get()), 3);
+    EXPECT_EQ(EXPECT_MGP_NO_ERROR(const double *, mgp_csr_graph_weights, csr.get()), nullptr);
+    const std::map<std::pair<int64_t, int64_t>, double> expected{{{vertex_ids[0], vertex_ids[1]}, 0.0},
+                                                                 {{vertex_ids[1], vertex_ids[0]}, 0.0},
+                                                                 {{vertex_ids[0], vertex_ids[2]}, 0.0}};
+    EXPECT_EQ(read_edges(csr.get()), expected);
+  }
+}
@@ -22,6 +22,7 @@
 #include "kafka_mock.hpp"
 #include "query/config.hpp"
 #include "query/interpreter.hpp"
+#include "query/stream/batching.hpp"
 #include "query/stream/streams.hpp"
 #include "storage/v2/disk/storage.hpp"
 #include "storage/v2/inmemory/storage.hpp"
@@ -344,3 +345,45 @@ TYPED_TEST(StreamsTestFixture, CheckInvalidCredentials) {
                             stream_name, stream_info, std::nullopt),
                         memgraph::integrations::kafka::SettingCustomConfigFailed, checker);
 }
+
+TEST(StreamsBatchingTest, MakeBatchedQuery) {
+  using memgraph::query::stream::MakeBatchedQuery;
+  EXPECT_EQ(MakeBatchedQuery("CREATE (:Node {id: $id, value: $value})"),
+            "UNWIND $__stream_batch AS __stream_row CREATE (:Node {id: __stream_row.id, value: __stream_row.value})");
+  // Parameters aren't replaced inside of literals, escaped names and comments.
+  EXPECT_EQ(MakeBatchedQuery("CREATE (:Node {id: $id, text: '$id', `$id`: \"\\\"$id\"}) // $id"),
+            "UNWIND $__stream_batch AS __stream_row "
+            "CREATE (:Node {id: __stream_row.id, text: '$id', `$id`: \"\\\"$id\"}) // $id");
+  // Numbered parameters can't be replaced with the fields of a map.
+  EXPECT_EQ(MakeBatchedQuery("CREATE (:Node {id: $0})"), std::nullopt);
+  EXPECT_EQ(MakeBatchedQuery("CREATE (:Node {id: $})"), std::nullopt);
+}
+
+TEST(StreamsBatchingTest, OnlyRowWiseQueriesAreBatched) {
+  memgraph::query::InterpreterContext interpreter_context{std::make_unique<memgraph::storage::InMemoryStorage>(),
+                                                          memgraph::query::InterpreterConfig{},
+                                                          GetCleanDataDirectory()};
+  const auto is_batched = [&interpreter_context](const std::string_view query) {
+    const auto batched_query = memgraph::query::stream::MakeBatchedQuery(query);
+    return batched_query && memgraph::query::stream::IsBatchedQueryValid(*batched_query, &interpreter_context);
+  };
+
+  EXPECT_TRUE(is_batched("CREATE (:Node {id: $id})"));
+  EXPECT_TRUE(is_batched("MATCH (n:Node {id: $id}) SET n.value = $value"));
+  EXPECT_TRUE(is_batched("MERGE (n:Node {id: $id}) ON CREATE SET n.value = $value"));
+  EXPECT_TRUE(is_batched("MATCH (n:Node {id: $id}) DETACH DELETE n"));
+  EXPECT_TRUE(is_batched("UNWIND $ids AS id FOREACH (i IN [id] | CREATE (:Node {id: i}))"));
+
+  // Read-only queries don't change anything, so there is nothing to batch.
+  EXPECT_FALSE(is_batched("MATCH (n:Node {id: $id}) RETURN n"));
+  // These would aggregate, sort or limit the rows of all of the executions at
+  // once instead of the rows of each execution on its own.
+  EXPECT_FALSE(is_batched("CREATE (n:Node {id: $id}) RETURN count(n)"));
+  EXPECT_FALSE(is_batched("MATCH (n:Node) WITH count(n) AS c CREATE (:Count {id: $id, count: c})"));
+  EXPECT_FALSE(is_batched("MATCH (n:Node) WITH n LIMIT 1 SET n.value = $value"));
+  EXPECT_FALSE(is_batched("MATCH (n:Node) WITH n ORDER BY n.id SKIP 1 SET n.value = $value"));
+  EXPECT_FALSE(
+      is_batched("CREATE (n:Node {id: $id}) RETURN n.id AS id UNION CREATE (m:Other {id: $id}) RETURN m.id AS id"));
+  EXPECT_FALSE(is_batched("CALL { CREATE (:Node) } CREATE (:Other {id: $id})"));
+  EXPECT_FALSE(is_batched("CREATE INDEX ON :Node(id)"));
+}
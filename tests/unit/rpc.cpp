@@ -1,4 +1,4 @@
-// Copyright 2022 Memgraph Ltd.
+// Copyright 2023 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -107,6 +107,41 @@ TEST(Rpc, Abort) {
   server.AwaitShutdown();
 }
 
+TEST(Rpc, CallAfterAbort) {
+  memgraph::communication::ServerContext server_context;
+  Server server({"127.0.0.1", 0}, &server_context);
+  server.Register<Sum>([](auto *req_reader, auto *res_builder) {
+    SumReq req;
+    memgraph::slk::Load(&req, req_reader);
+    std::this_thread::sleep_for(200ms);
+    SumRes res(req.x + req.y);
+    memgraph::slk::Save(res, res_builder);
+  });
+  ASSERT_TRUE(server.Start());
+  std::this_thread::sleep_for(100ms);
+
+  memgraph::communication::ClientContext client_context;
+  Client client(server.endpoint(), &client_context);
+
+  // All of the pipelined calls fail when the connection is aborted, and the
+  // connection is replaced by the next call.
+  auto first = client.CallAsync<Sum>(1, 2);
+  auto second = client.CallAsync<Sum>(3, 4);
+  std::thread thread([&client]() {
+    std::this_thread::sleep_for(100ms);
+    client.Abort();
+  });
+  EXPECT_THROW(first.AwaitResponse(), RpcFailedException);
+  EXPECT_THROW(second.AwaitResponse(), RpcFailedException);
+  thread.join();
+
+  auto sum = client.Call<Sum>(5, 6);
+  EXPECT_EQ(sum.sum, 11);
+
+  server.Shutdown();
+  server.AwaitShutdown();
+}
+
 TEST(Rpc, ClientPool) {
   memgraph::communication::ServerContext server_context;
   Server server({"127.0.0.1", 0}, &server_context);
@@ -292,3 +327,37 @@ TEST(Rpc, StreamJumbo) {
   server.Shutdown();
   server.AwaitShutdown();
 }
+
+TEST(Rpc, Pipeline) {
+  memgraph::communication::ServerContext server_context;
+  Server server({"127.0.0.1", 0}, &server_context);
+  server.Register<Sum>([](auto *req_reader, auto *res_builder) {
+    SumReq req;
+    memgraph::slk::Load(&req, req_reader);
+    SumRes res(req.x + req.y);
+    memgraph::slk::Save(res, res_builder);
+  });
+  ASSERT_TRUE(server.Start());
+  std::this_thread::sleep_for(100ms);
+
+  memgraph::communication::ClientContext client_context;
+  Client client(server.endpoint(), &client_context);
+  auto first = client.CallAsync<Sum>(1, 2);
+  auto second = client.CallAsync<Sum>(3, 4);
+  {
+    // The response of a dropped call is discarded.
+    auto dropped = client.CallAsync<Sum>(5, 6);
+  }
+  auto third = client.CallAsync<Sum>(7, 8);
+  EXPECT_EQ(third.AwaitResponse().sum, 15);
+  EXPECT_EQ(first.AwaitResponse().sum, 3);
+
+  std::thread thread([&second] { EXPECT_EQ(second.AwaitResponse().sum, 7); });
+  thread.join();
+
+  auto sum = client.Call<Sum>(10, 20);
+  EXPECT_EQ(sum.sum, 30);
+
+  server.Shutdown();
+  server.AwaitShutdown();
+}
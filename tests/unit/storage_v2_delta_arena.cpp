@@ -0,0 +1,72 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "storage/v2/delta_arena.hpp"
+
+using memgraph::storage::Delta;
+using memgraph::storage::DeltaArena;
+
+TEST(StorageV2DeltaArena, Empty) {
+  DeltaArena arena;
+  ASSERT_TRUE(arena.empty());
+  ASSERT_EQ(arena.size(), 0);
+  ASSERT_EQ(arena.begin(), arena.end());
+}
+
+TEST(StorageV2DeltaArena, IterationOrderAndStableAddresses) {
+  std::atomic<uint64_t> timestamp{42};
+  DeltaArena arena;
+  std::vector<Delta *> created;
+  // Enough deltas to span multiple chunks, including the largest ones.
+  const uint64_t count = 3 * DeltaArena::kMaxChunkCapacity + 5;
+  for (uint64_t i = 0; i < count; ++i) {
+    created.push_back(&arena.emplace_back(Delta::DeleteObjectTag(), &timestamp, i));
+  }
+  ASSERT_EQ(arena.size(), count);
+
+  // Moving the arena must not move the deltas.
+  DeltaArena moved(std::move(arena));
+  ASSERT_TRUE(arena.empty());
+  ASSERT_EQ(moved.size(), count);
+
+  uint64_t i = 0;
+  for (const auto &delta : moved) {
+    ASSERT_LT(i, count);
+    ASSERT_EQ(&delta, created[i]);
+    ASSERT_EQ(delta.command_id, i);
+    ASSERT_EQ(delta.action, Delta::Action::DELETE_OBJECT);
+    ++i;
+  }
+  ASSERT_EQ(i, count);
+
+  moved.clear();
+  ASSERT_TRUE(moved.empty());
+  ASSERT_EQ(moved.begin(), moved.end());
+}
+
+TEST(StorageV2DeltaArena, DestroysDeltas) {
+  std::atomic<uint64_t> timestamp{42};
+  DeltaArena arena;
+  // Deltas holding a property value own memory which has to be released when
+  // the arena is destroyed (checked by the sanitizers).
+  for (uint64_t i = 0; i < 100; ++i) {
+    arena.emplace_back(Delta::SetPropertyTag(), memgraph::storage::PropertyId::FromUint(1),
+                       memgraph::storage::PropertyValue(std::string(100, 'a')), &timestamp, i);
+  }
+  DeltaArena other;
+  other.emplace_back(Delta::DeleteObjectTag(), &timestamp, 0);
+  other = std::move(arena);
+  ASSERT_EQ(other.size(), 100);
+}
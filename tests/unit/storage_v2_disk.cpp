@@ -9,6 +9,7 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <fmt/format.h>
 #include <gtest/gtest.h>
 
 #include "disk_test_utils.hpp"
@@ -27,3 +28,148 @@ TEST_F(DiskStorageTest, CreateDiskStorageInDataDirectory) {
 
   disk_test_utils::RemoveRocksDbDirs(testSuite);
 }
+
+TEST_F(DiskStorageTest, OpenWithDiskOptions) {
+  const std::string testSuite = "storage_v2_disk_options";
+  using Compression = memgraph::storage::Config::DiskConfig::Compression;
+
+  for (const auto compression : {Compression::NONE, Compression::LZ4, Compression::ZSTD}) {
+    for (const uint64_t block_cache_size_mib : {0, 16}) {
+      for (const uint64_t bloom_filter_bits_per_key : {0, 10}) {
+        SCOPED_TRACE(fmt::format("compression {}, block cache {}MiB, bloom filter {} bits per key",
+                                 static_cast<int>(compression), block_cache_size_mib, bloom_filter_bits_per_key));
+        memgraph::storage::Config config = disk_test_utils::GenerateOnDiskConfig(testSuite);
+        config.disk.compression = compression;
+        config.disk.block_cache_size_mib = block_cache_size_mib;
+        config.disk.bloom_filter_bits_per_key = bloom_filter_bits_per_key;
+
+        memgraph::storage::Gid gid;
+        {
+          auto storage = std::make_unique<memgraph::storage::DiskStorage>(config);
+          auto acc = storage->Access(std::nullopt);
+          auto vertex = acc->CreateVertex();
+          gid = vertex.Gid();
+          const auto property = acc->NameToProperty("property");
+          ASSERT_TRUE(vertex.SetProperty(property, memgraph::storage::PropertyValue("value")).HasValue());
+          ASSERT_FALSE(acc->Commit().HasError());
+        }
+        {
+          auto storage = std::make_unique<memgraph::storage::DiskStorage>(config);
+          auto acc = storage->Access(std::nullopt);
+          auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+          ASSERT_TRUE(vertex);
+          auto value = vertex->GetProperty(acc->NameToProperty("property"), memgraph::storage::View::OLD);
+          ASSERT_TRUE(value.HasValue());
+          ASSERT_EQ(*value, memgraph::storage::PropertyValue("value"));
+        }
+        disk_test_utils::RemoveRocksDbDirs(testSuite);
+      }
+    }
+  }
+}
+
+class DiskIndexStatsTest : public ::testing::Test {
+ protected:
+  void TearDown() override { disk_test_utils::RemoveRocksDbDirs(testSuite); }
+
+  std::unique_ptr<memgraph::storage::Storage> Restart() {
+    storage.reset();
+    return std::make_unique<memgraph::storage::DiskStorage>(config);
+  }
+
+  const std::string testSuite = "storage_v2_disk_index_stats";
+  memgraph::storage::Config config = disk_test_utils::GenerateOnDiskConfig(testSuite);
+  std::unique_ptr<memgraph::storage::Storage> storage = std::make_unique<memgraph::storage::DiskStorage>(config);
+};
+
+TEST_F(DiskIndexStatsTest, IndexStatsSurviveRestart) {
+  const auto label = storage->NameToLabel("Label");
+  const auto property = storage->NameToProperty("property");
+  ASSERT_FALSE(storage->CreateIndex(label).HasError());
+  ASSERT_FALSE(storage->CreateIndex(label, property).HasError());
+  {
+    auto acc = storage->Access();
+    acc->SetIndexStats(label, memgraph::storage::LabelIndexStats{42, 1.5});
+    acc->SetIndexStats(label, property, memgraph::storage::LabelPropertyIndexStats{42, 7, 0.25, 6.0, 1.5});
+  }
+
+  storage = Restart();
+  auto acc = storage->Access();
+  const auto label_stats = acc->GetIndexStats(label);
+  ASSERT_TRUE(label_stats);
+  ASSERT_EQ(label_stats->count, 42);
+  ASSERT_EQ(label_stats->avg_degree, 1.5);
+  const auto label_property_stats = acc->GetIndexStats(label, property);
+  ASSERT_TRUE(label_property_stats);
+  ASSERT_EQ(label_property_stats->count, 42);
+  ASSERT_EQ(label_property_stats->distinct_values_count, 7);
+  ASSERT_EQ(label_property_stats->statistic, 0.25);
+  ASSERT_EQ(label_property_stats->avg_group_size, 6.0);
+  ASSERT_EQ(label_property_stats->avg_degree, 1.5);
+}
+
+TEST_F(DiskIndexStatsTest, DeletedIndexStatsStayDeletedAfterRestart) {
+  const auto deleted_label = storage->NameToLabel("Deleted");
+  const auto kept_label = storage->NameToLabel("Kept");
+  const auto property = storage->NameToProperty("property");
+  {
+    auto acc = storage->Access();
+    acc->SetIndexStats(deleted_label, memgraph::storage::LabelIndexStats{1, 1.0});
+    acc->SetIndexStats(kept_label, memgraph::storage::LabelIndexStats{2, 2.0});
+    acc->SetIndexStats(deleted_label, property, memgraph::storage::LabelPropertyIndexStats{1, 1, 1.0, 1.0, 1.0});
+    acc->SetIndexStats(kept_label, property, memgraph::storage::LabelPropertyIndexStats{2, 2, 2.0, 2.0, 2.0});
+    std::vector<std::string> labels{"Deleted"};
+    ASSERT_EQ(acc->DeleteLabelIndexStats(labels).size(), 1);
+    ASSERT_EQ(acc->DeleteLabelPropertyIndexStats(labels).size(), 1);
+  }
+
+  storage = Restart();
+  auto acc = storage->Access();
+  ASSERT_FALSE(acc->GetIndexStats(deleted_label));
+  ASSERT_FALSE(acc->GetIndexStats(deleted_label, property));
+  ASSERT_TRUE(acc->GetIndexStats(kept_label));
+  ASSERT_TRUE(acc->GetIndexStats(kept_label, property));
+}
+
+TEST_F(DiskIndexStatsTest, ClearedIndexStatsStayClearedAfterRestart) {
+  const auto label = storage->NameToLabel("Label");
+  const auto property = storage->NameToProperty("property");
+  {
+    auto acc = storage->Access();
+    acc->SetIndexStats(label, memgraph::storage::LabelIndexStats{1, 1.0});
+    acc->SetIndexStats(label, property, memgraph::storage::LabelPropertyIndexStats{1, 1, 1.0, 1.0, 1.0});
+    ASSERT_EQ(acc->ClearLabelIndexStats().size(), 1);
+    ASSERT_EQ(acc->ClearLabelPropertyIndexStats().size(), 1);
+  }
+
+  storage = Restart();
+  auto acc = storage->Access();
+  ASSERT_FALSE(acc->GetIndexStats(label));
+  ASSERT_FALSE(acc->GetIndexStats(label, property));
+}
+
+TEST_F(DiskIndexStatsTest, DropIndexDeletesIndexStats) {
+  const auto label = storage->NameToLabel("Label");
+  const auto property = storage->NameToProperty("property");
+  ASSERT_FALSE(storage->CreateIndex(label).HasError());
+  ASSERT_FALSE(storage->CreateIndex(label, property).HasError());
+  {
+    auto acc = storage->Access();
+    acc->SetIndexStats(label, memgraph::storage::LabelIndexStats{1, 1.0});
+    acc->SetIndexStats(label, property, memgraph::storage::LabelPropertyIndexStats{1, 1, 1.0, 1.0, 1.0});
+  }
+  ASSERT_FALSE(storage->DropIndex(label).HasError());
+  ASSERT_FALSE(storage->DropIndex(label, property).HasError());
+  {
+    auto acc = storage->Access();
+    ASSERT_FALSE(acc->GetIndexStats(label));
+    ASSERT_FALSE(acc->GetIndexStats(label, property));
+  }
+
+  storage = Restart();
+  ASSERT_FALSE(storage->CreateIndex(label).HasError());
+  ASSERT_FALSE(storage->CreateIndex(label, property).HasError());
+  auto acc = storage->Access();
+  ASSERT_FALSE(acc->GetIndexStats(label));
+  ASSERT_FALSE(acc->GetIndexStats(label, property));
+}
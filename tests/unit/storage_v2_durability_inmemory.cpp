@@ -699,6 +699,32 @@ TEST_P(DurabilityTest, SnapshotOnExit) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, SnapshotOnExitParallel) {
+  // Create snapshot. Small batches make every worker encode several ranges.
+  {
+    std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {.storage_directory = storage_directory,
+                        .snapshot_on_exit = true,
+                        .items_per_batch = 13,
+                        .allow_parallel_snapshot_creation = true,
+                        .snapshot_thread_count = 4}}));
+    CreateBaseDataset(store.get(), GetParam());
+    CreateExtendedDataset(store.get());
+    VerifyDataset(store.get(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  ASSERT_EQ(GetWalsList().size(), 0);
+
+  // Recover snapshot.
+  std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+      {.items = {.properties_on_edges = GetParam()},
+       .durability = {.storage_directory = storage_directory, .recover_on_startup = true}}));
+  VerifyDataset(store.get(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, SnapshotPeriodic) {
   // Create snapshot.
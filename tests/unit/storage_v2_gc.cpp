@@ -200,3 +200,74 @@ TEST(StorageV2Gc, Indices) {
     EXPECT_EQ(gids.size(), 1000);
   }
 }
+
+// Index GC only checks the entries which were made obsolete by the cleaned up
+// transactions. Checks that the entries made obsolete by removed labels,
+// changed properties, deleted vertices and aborted transactions are all
+// removed from the indices.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, IndicesRemoveObsoleteEntries) {
+  std::unique_ptr<memgraph::storage::Storage> storage(
+      std::make_unique<memgraph::storage::InMemoryStorage>(memgraph::storage::Config{
+          .gc = {.type = memgraph::storage::Config::Gc::Type::PERIODIC, .interval = std::chrono::milliseconds(100)}}));
+
+  auto label = storage->NameToLabel("label");
+  auto property = storage->NameToProperty("property");
+  ASSERT_FALSE(storage->CreateIndex(label).HasError());
+  ASSERT_FALSE(storage->CreateIndex(label, property).HasError());
+
+  {
+    auto acc = storage->Access();
+    for (int64_t i = 0; i < 1000; ++i) {
+      auto vertex = acc->CreateVertex();
+      ASSERT_TRUE(*vertex.AddLabel(label));
+      ASSERT_TRUE(vertex.SetProperty(property, memgraph::storage::PropertyValue(i)).HasValue());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = storage->Access();
+    int64_t i = 0;
+    for (auto vertex : acc->Vertices(memgraph::storage::View::OLD)) {
+      switch (i++ % 4) {
+        case 0:
+          ASSERT_TRUE(*vertex.RemoveLabel(label));
+          break;
+        case 1:
+          ASSERT_TRUE(vertex.SetProperty(property, memgraph::storage::PropertyValue(-i)).HasValue());
+          break;
+        case 2:
+          ASSERT_TRUE(acc->DeleteVertex(&vertex).HasValue());
+          break;
+        default:
+          break;
+      }
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = storage->Access();
+    for (auto vertex : acc->Vertices(memgraph::storage::View::OLD)) {
+      ASSERT_TRUE(vertex.SetProperty(property, memgraph::storage::PropertyValue("aborted")).HasValue());
+    }
+    for (int64_t i = 0; i < 100; ++i) {
+      auto vertex = acc->CreateVertex();
+      ASSERT_TRUE(*vertex.AddLabel(label));
+      ASSERT_TRUE(vertex.SetProperty(property, memgraph::storage::PropertyValue(i)).HasValue());
+    }
+    acc->Abort();
+  }
+
+  // Wait for GC.
+  std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+  auto acc = storage->Access();
+  EXPECT_EQ(acc->ApproximateVertexCount(label), 500);
+  EXPECT_EQ(acc->ApproximateVertexCount(label, property), 500);
+  int64_t count = 0;
+  for (auto vertex : acc->Vertices(label, property, memgraph::storage::View::OLD)) {
+    ASSERT_TRUE(vertex.GetProperty(property, memgraph::storage::View::OLD)->IsInt());
+    ++count;
+  }
+  EXPECT_EQ(count, 500);
+}
@@ -14,6 +14,9 @@
 #include <gtest/gtest.h>
 #include <gtest/internal/gtest-type-util.h>
 
+#include <atomic>
+#include <thread>
+
 #include "disk_test_utils.hpp"
 #include "storage/v2/disk/storage.hpp"
 #include "storage/v2/inmemory/storage.hpp"
@@ -403,6 +406,94 @@ TYPED_TEST(IndexTest, LabelIndexCountEstimate) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, LabelIndexCreateWithConcurrentWriters) {
+  if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    {
+      auto acc = this->storage->Access();
+      for (int i = 0; i < 10000; ++i) {
+        ASSERT_NO_ERROR(acc->CreateVertex().AddLabel(this->label1));
+      }
+      ASSERT_NO_ERROR(acc->Commit());
+    }
+
+    // Vertices added while the index is being built must end up in it as well.
+    std::thread writer([this] {
+      for (int i = 0; i < 1000; ++i) {
+        auto acc = this->storage->Access();
+        MG_ASSERT(!acc->CreateVertex().AddLabel(this->label1).HasError());
+        MG_ASSERT(!acc->Commit().HasError());
+      }
+    });
+    EXPECT_FALSE(this->storage->CreateIndex(this->label1).HasError());
+    writer.join();
+
+    auto info = this->storage->ListAllIndices();
+    EXPECT_THAT(info.label, UnorderedElementsAre(this->label1));
+    EXPECT_THAT(info.label_populating, IsEmpty());
+
+    auto acc = this->storage->Access();
+    ASSERT_TRUE(acc->LabelIndexExists(this->label1));
+    uint64_t count = 0;
+    for ([[maybe_unused]] auto vertex : acc->Vertices(this->label1, View::OLD)) {
+      ++count;
+    }
+    EXPECT_EQ(count, 11000);
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, IndexCreateWithConcurrentAbortedWriters) {
+  if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    std::vector<memgraph::storage::Gid> gids;
+    {
+      auto acc = this->storage->Access();
+      for (int i = 0; i < 10000; ++i) {
+        auto vertex = this->CreateVertex(acc.get());
+        ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+        ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(i)));
+        gids.push_back(vertex.Gid());
+      }
+      ASSERT_NO_ERROR(acc->Commit());
+    }
+
+    // Changes which are aborted while the indices are being built mustn't make
+    // the indices miss the vertices they were made to.
+    std::atomic<bool> done{false};
+    std::thread writer([this, &gids, &done] {
+      for (uint64_t i = 0; !done.load(); ++i) {
+        auto acc = this->storage->Access();
+        auto vertex = acc->FindVertex(gids[i % gids.size()], View::OLD);
+        MG_ASSERT(vertex);
+        switch (i % 3) {
+          case 0:
+            MG_ASSERT(!vertex->RemoveLabel(this->label1).HasError());
+            break;
+          case 1:
+            MG_ASSERT(!vertex->SetProperty(this->prop_val, PropertyValue()).HasError());
+            break;
+          case 2:
+            MG_ASSERT(!acc->DeleteVertex(&*vertex).HasError());
+            break;
+        }
+        acc->Abort();
+      }
+    });
+    EXPECT_FALSE(this->storage->CreateIndex(this->label1).HasError());
+    EXPECT_FALSE(this->storage->CreateIndex(this->label1, this->prop_val).HasError());
+    done.store(true);
+    writer.join();
+
+    auto acc = this->storage->Access();
+    uint64_t label_count = 0;
+    for ([[maybe_unused]] auto vertex : acc->Vertices(this->label1, View::OLD)) {
+      ++label_count;
+    }
+    EXPECT_EQ(label_count, gids.size());
+    EXPECT_EQ(this->GetIds(acc->Vertices(this->label1, this->prop_val, View::OLD), View::OLD).size(), gids.size());
+  }
+}
+
 TYPED_TEST(IndexTest, LabelIndexDeletedVertex) {
   if constexpr ((std::is_same_v<TypeParam, memgraph::storage::DiskStorage>)) {
     EXPECT_FALSE(this->storage->CreateIndex(this->label1).HasError());
@@ -16,8 +16,10 @@
 
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_store.hpp"
+#include "storage/v2/property_string_dictionary.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/temporal.hpp"
+#include "utils/on_scope_exit.hpp"
 
 using testing::UnorderedElementsAre;
 
@@ -727,3 +729,135 @@ TEST(PropertyStore, HasAnyProperties) {
   EXPECT_FALSE(store.HasAllPropertyValues({memgraph::storage::PropertyValue(0.0), memgraph::storage::PropertyValue(123),
                                            memgraph::storage::PropertyValue("three")}));
 }
+
+TEST(PropertyStore, ManyProperties) {
+  // Enough properties for the store to use the property directory. Every
+  // other ID is skipped so that lookups of missing properties fall between
+  // the stored ones.
+  const int64_t kNumProperties = 100;
+  std::map<memgraph::storage::PropertyId, memgraph::storage::PropertyValue> expected;
+  memgraph::storage::PropertyStore props;
+  for (int64_t i = kNumProperties - 1; i >= 0; --i) {
+    auto prop = memgraph::storage::PropertyId::FromInt(i * 2 + 1);
+    auto value = i % 2 == 0 ? memgraph::storage::PropertyValue(i * 1000)
+                            : memgraph::storage::PropertyValue(std::string(i, 'a'));
+    ASSERT_TRUE(props.SetProperty(prop, value));
+    expected.emplace(prop, value);
+  }
+
+  auto check = [&](const memgraph::storage::PropertyStore &store) {
+    for (int64_t i = 0; i < kNumProperties * 2 + 2; ++i) {
+      auto prop = memgraph::storage::PropertyId::FromInt(i);
+      auto it = expected.find(prop);
+      if (it == expected.end()) {
+        ASSERT_TRUE(store.GetProperty(prop).IsNull());
+        ASSERT_FALSE(store.HasProperty(prop));
+        ASSERT_TRUE(store.IsPropertyEqual(prop, memgraph::storage::PropertyValue()));
+      } else {
+        ASSERT_EQ(store.GetProperty(prop), it->second);
+        ASSERT_TRUE(store.HasProperty(prop));
+        ASSERT_TRUE(store.IsPropertyEqual(prop, it->second));
+        ASSERT_FALSE(store.IsPropertyEqual(prop, memgraph::storage::PropertyValue(-1)));
+      }
+    }
+    ASSERT_EQ(store.Properties(), expected);
+  };
+  check(props);
+
+  // The directory is a part of the buffer which is stored on disk.
+  check(memgraph::storage::PropertyStore::CreateFromBuffer(props.StringBuffer()));
+
+  // Changing the size of a property moves all of the following ones.
+  for (int64_t i = 0; i < kNumProperties; i += 3) {
+    auto prop = memgraph::storage::PropertyId::FromInt(i * 2 + 1);
+    auto value = memgraph::storage::PropertyValue(std::string(1000, 'b'));
+    ASSERT_FALSE(props.SetProperty(prop, value));
+    expected[prop] = value;
+  }
+  check(props);
+
+  // Removing properties eventually drops the directory.
+  for (int64_t i = 0; i < kNumProperties; ++i) {
+    auto prop = memgraph::storage::PropertyId::FromInt(i * 2 + 1);
+    ASSERT_FALSE(props.SetProperty(prop, memgraph::storage::PropertyValue()));
+    expected.erase(prop);
+    check(props);
+  }
+
+  std::vector<std::pair<memgraph::storage::PropertyId, memgraph::storage::PropertyValue>> init;
+  for (int64_t i = 0; i < kNumProperties; ++i) {
+    auto prop = memgraph::storage::PropertyId::FromInt(i * 2 + 1);
+    auto value = memgraph::storage::PropertyValue(i);
+    init.emplace_back(prop, value);
+    expected.emplace(prop, value);
+  }
+  ASSERT_TRUE(props.InitProperties(init));
+  check(props);
+  ASSERT_TRUE(props.ClearProperties());
+  expected.clear();
+  check(props);
+}
+
+TEST(PropertyStore, InternedStrings) {
+  auto &dictionary = memgraph::storage::PropertyStringDictionary::Global();
+  // The dictionary is shared by the whole process, so leave it as it was even
+  // if an assertion fails halfway through.
+  memgraph::utils::OnScopeExit restore_dictionary{[&dictionary, max_length = dictionary.MaxLength()] {
+    dictionary.SetMaxLength(max_length);
+    dictionary.CollectGarbage();
+  }};
+  dictionary.SetMaxLength(8);
+
+  const auto prop = memgraph::storage::PropertyId::FromInt(42);
+  const auto other_prop = memgraph::storage::PropertyId::FromInt(43);
+  const auto short_value = memgraph::storage::PropertyValue("Croatia");
+  const auto long_value = memgraph::storage::PropertyValue("United Kingdom");
+  {
+    std::vector<memgraph::storage::PropertyStore> stores(100);
+    for (auto &store : stores) {
+      ASSERT_TRUE(store.SetProperty(prop, short_value));
+      ASSERT_TRUE(store.SetProperty(other_prop, long_value));
+    }
+    ASSERT_EQ(dictionary.Size(), 1);
+
+    auto &store = stores.front();
+    ASSERT_EQ(store.GetProperty(prop), short_value);
+    ASSERT_TRUE(store.IsPropertyEqual(prop, short_value));
+    ASSERT_FALSE(store.IsPropertyEqual(prop, memgraph::storage::PropertyValue("Croati")));
+    ASSERT_FALSE(store.IsPropertyEqual(prop, memgraph::storage::PropertyValue(7)));
+    ASSERT_THAT(store.Properties(),
+                UnorderedElementsAre(std::pair(prop, short_value), std::pair(other_prop, long_value)));
+
+    // The buffer stores the strings inline because the IDs are valid only in
+    // this process.
+    auto restored = memgraph::storage::PropertyStore::CreateFromBuffer(store.StringBuffer());
+    dictionary.SetMaxLength(0);
+    ASSERT_EQ(restored.GetProperty(prop), short_value);
+    ASSERT_EQ(restored.GetProperty(other_prop), long_value);
+    dictionary.SetMaxLength(8);
+
+    // Replacing the value releases the reference held by the old one.
+    const auto new_value = memgraph::storage::PropertyValue("Austria");
+    ASSERT_FALSE(store.SetProperty(prop, new_value));
+    ASSERT_EQ(store.GetProperty(prop), new_value);
+    ASSERT_EQ(stores.back().GetProperty(prop), short_value);
+    ASSERT_FALSE(store.SetProperty(prop, new_value));
+    ASSERT_EQ(store.GetProperty(prop), new_value);
+    ASSERT_EQ(dictionary.Size(), 2);
+
+    ASSERT_TRUE(store.ClearProperties());
+    std::map<memgraph::storage::PropertyId, memgraph::storage::PropertyValue> properties{{prop, short_value},
+                                                                                         {other_prop, new_value}};
+    ASSERT_TRUE(store.InitProperties(properties));
+    ASSERT_EQ(store.Properties(), properties);
+    ASSERT_EQ(dictionary.Size(), 2);
+
+    // Austria is referenced only by the first store.
+    store = memgraph::storage::PropertyStore();
+    dictionary.CollectGarbage();
+    ASSERT_EQ(dictionary.Size(), 1);
+    ASSERT_EQ(stores.back().GetProperty(prop), short_value);
+  }
+  dictionary.CollectGarbage();
+  ASSERT_EQ(dictionary.Size(), 0);
+}
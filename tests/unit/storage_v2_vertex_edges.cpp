@@ -0,0 +1,127 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "storage/v2/vertex_edges.hpp"
+
+using memgraph::storage::EdgeRef;
+using memgraph::storage::EdgeTypeId;
+using memgraph::storage::Gid;
+using memgraph::storage::Vertex;
+using memgraph::storage::VertexEdges;
+
+namespace {
+
+Vertex *FakeVertex(uint64_t id) { return reinterpret_cast<Vertex *>((id + 1) * alignof(std::max_align_t)); }
+
+std::vector<std::tuple<uint64_t, Vertex *, uint64_t>> Sorted(std::vector<std::tuple<uint64_t, Vertex *, uint64_t>> v) {
+  std::sort(v.begin(), v.end());
+  return v;
+}
+
+std::vector<std::tuple<uint64_t, Vertex *, uint64_t>> Collect(const VertexEdges &edges) {
+  std::vector<std::tuple<uint64_t, Vertex *, uint64_t>> result;
+  for (const auto &[edge_type, vertex, edge] : edges) {
+    result.emplace_back(edge_type.AsUint(), vertex, edge.gid.AsUint());
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(StorageV2VertexEdges, Empty) {
+  VertexEdges edges;
+  ASSERT_TRUE(edges.empty());
+  ASSERT_EQ(edges.size(), 0);
+  ASSERT_EQ(edges.begin(), edges.end());
+  ASSERT_TRUE(edges.EdgesOfType(EdgeTypeId::FromUint(0)).empty());
+  ASSERT_FALSE(edges.Remove(EdgeTypeId::FromUint(0), FakeVertex(0), EdgeRef(Gid::FromUint(0))));
+}
+
+TEST(StorageV2VertexEdges, GroupsByType) {
+  VertexEdges edges;
+  // Interleave the types so that every insertion has to shift other groups.
+  for (uint64_t i = 0; i < 30; ++i) {
+    edges.Add(EdgeTypeId::FromUint(2 - i % 3), FakeVertex(i), EdgeRef(Gid::FromUint(i)));
+  }
+  ASSERT_EQ(edges.size(), 30);
+  for (uint64_t type = 0; type < 3; ++type) {
+    auto of_type = edges.EdgesOfType(EdgeTypeId::FromUint(type));
+    ASSERT_EQ(of_type.size(), 10);
+    for (const auto &entry : of_type) {
+      ASSERT_EQ(2 - entry.edge.gid.AsUint() % 3, type);
+      ASSERT_EQ(entry.vertex, FakeVertex(entry.edge.gid.AsUint()));
+    }
+  }
+  ASSERT_TRUE(edges.EdgesOfType(EdgeTypeId::FromUint(3)).empty());
+  ASSERT_TRUE(edges.Contains(EdgeTypeId::FromUint(1), FakeVertex(1), EdgeRef(Gid::FromUint(1))));
+  ASSERT_FALSE(edges.Contains(EdgeTypeId::FromUint(0), FakeVertex(1), EdgeRef(Gid::FromUint(1))));
+}
+
+TEST(StorageV2VertexEdges, RandomOperations) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<uint64_t> type_dist(0, 7);
+  std::uniform_int_distribution<int> op_dist(0, 2);
+  VertexEdges edges;
+  std::vector<std::tuple<uint64_t, Vertex *, uint64_t>> expected;
+  uint64_t next_gid = 0;
+  for (int i = 0; i < 5000; ++i) {
+    if (expected.empty() || op_dist(gen) != 0) {
+      const auto type = type_dist(gen);
+      const auto gid = next_gid++;
+      edges.Add(EdgeTypeId::FromUint(type), FakeVertex(gid % 13), EdgeRef(Gid::FromUint(gid)));
+      expected.emplace_back(type, FakeVertex(gid % 13), gid);
+    } else {
+      std::uniform_int_distribution<size_t> pos_dist(0, expected.size() - 1);
+      const auto pos = pos_dist(gen);
+      const auto [type, vertex, gid] = expected[pos];
+      ASSERT_TRUE(edges.Remove(EdgeTypeId::FromUint(type), vertex, EdgeRef(Gid::FromUint(gid))));
+      ASSERT_FALSE(edges.Remove(EdgeTypeId::FromUint(type), vertex, EdgeRef(Gid::FromUint(gid))));
+      expected.erase(expected.begin() + static_cast<std::ptrdiff_t>(pos));
+    }
+    ASSERT_EQ(edges.size(), expected.size());
+  }
+  ASSERT_EQ(Sorted(Collect(edges)), Sorted(expected));
+  for (uint64_t type = 0; type < 8; ++type) {
+    auto of_type = edges.EdgesOfType(EdgeTypeId::FromUint(type));
+    ASSERT_EQ(of_type.size(), std::count_if(expected.begin(), expected.end(),
+                                            [type](const auto &item) { return std::get<0>(item) == type; }));
+  }
+}
+
+TEST(StorageV2VertexEdges, CopyAndMove) {
+  VertexEdges edges;
+  edges.reserve(4);
+  for (uint64_t i = 0; i < 20; ++i) {
+    edges.Add(EdgeTypeId::FromUint(i % 4), FakeVertex(i), EdgeRef(Gid::FromUint(i)));
+  }
+  const auto expected = Sorted(Collect(edges));
+
+  VertexEdges copy(edges);
+  ASSERT_EQ(Sorted(Collect(copy)), expected);
+  ASSERT_TRUE(copy.Remove(EdgeTypeId::FromUint(0), FakeVertex(0), EdgeRef(Gid::FromUint(0))));
+  ASSERT_EQ(copy.size(), 19);
+  ASSERT_EQ(Sorted(Collect(edges)), expected);
+
+  VertexEdges moved(std::move(edges));
+  ASSERT_EQ(Sorted(Collect(moved)), expected);
+
+  copy = moved;
+  ASSERT_EQ(Sorted(Collect(copy)), expected);
+  copy = VertexEdges();
+  ASSERT_TRUE(copy.empty());
+  ASSERT_EQ(copy.begin(), copy.end());
+}
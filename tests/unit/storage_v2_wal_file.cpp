@@ -142,22 +142,35 @@ class DeltaGenerator final {
       }
     }
 
-    void Finalize(bool append_transaction_end = true) {
+    void Finalize(bool append_transaction_end = true, bool buffered = false) {
       auto commit_timestamp = gen_->timestamp_++;
       if (transaction_.deltas.empty()) return;
+      memgraph::storage::durability::WalDeltasBuffer buffer({.properties_on_edges = gen_->properties_on_edges_},
+                                                            &gen_->mapper_);
       for (const auto &delta : transaction_.deltas) {
         auto owner = delta.prev.Get();
         while (owner.type == memgraph::storage::PreviousPtr::Type::DELTA) {
           owner = owner.delta->prev.Get();
         }
         if (owner.type == memgraph::storage::PreviousPtr::Type::VERTEX) {
-          gen_->wal_file_.AppendDelta(delta, *owner.vertex, commit_timestamp);
+          if (buffered) {
+            buffer.AppendDelta(delta, *owner.vertex);
+          } else {
+            gen_->wal_file_.AppendDelta(delta, *owner.vertex, commit_timestamp);
+          }
         } else if (owner.type == memgraph::storage::PreviousPtr::Type::EDGE) {
-          gen_->wal_file_.AppendDelta(delta, *owner.edge, commit_timestamp);
+          if (buffered) {
+            buffer.AppendDelta(delta, *owner.edge);
+          } else {
+            gen_->wal_file_.AppendDelta(delta, *owner.edge, commit_timestamp);
+          }
         } else {
           LOG_FATAL("Invalid delta owner!");
         }
       }
+      if (buffered) {
+        gen_->wal_file_.AppendDeltas(buffer, commit_timestamp);
+      }
       if (append_transaction_end) {
         gen_->wal_file_.AppendTransactionEnd(commit_timestamp);
         if (gen_->valid_) {
@@ -197,6 +210,7 @@ class DeltaGenerator final {
       : uuid_(memgraph::utils::GenerateUUID()),
         epoch_id_(memgraph::utils::GenerateUUID()),
         seq_num_(seq_num),
+        properties_on_edges_(properties_on_edges),
         wal_file_(data_directory, uuid_, epoch_id_, {.properties_on_edges = properties_on_edges}, &mapper_, seq_num,
                   &file_retainer_),
         storage_mode_(storage_mode) {}
@@ -268,6 +282,7 @@ class DeltaGenerator final {
   std::string uuid_;
   std::string epoch_id_;
   uint64_t seq_num_;
+  bool properties_on_edges_;
 
   uint64_t transaction_id_{memgraph::storage::kTransactionInitialId};
   uint64_t timestamp_{memgraph::storage::kTimestampInitialId};
@@ -538,6 +553,22 @@ GENERATE_SIMPLE_TEST(InvalidTransactionOrdering, {
   TRANSACTION(true, { tx.CreateVertex(); });
 });
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+GENERATE_SIMPLE_TEST(BufferedTransactionDeltas, {
+  TRANSACTION(true, { tx.CreateVertex(); });
+  {
+    auto tx = gen.CreateTransaction();
+    auto vertex1 = tx.CreateVertex();
+    auto vertex2 = tx.CreateVertex();
+    tx.AddLabel(vertex1, "test");
+    tx.SetProperty(vertex2, "hello", memgraph::storage::PropertyValue("nandare"));
+    tx.RemoveLabel(vertex1, "test");
+    tx.DeleteVertex(vertex1);
+    tx.Finalize(true, true);
+  }
+  TRANSACTION(true, { tx.CreateVertex(); });
+});
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(WalFileTest, InvalidMarker) {
   memgraph::storage::durability::WalInfo info;
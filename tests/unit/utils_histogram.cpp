@@ -9,6 +9,9 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <thread>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -45,3 +48,26 @@ TEST(Histogram, BasicFunctionality) {
 
   ASSERT_NEAR(diff, 0, 0.01);
 }
+
+TEST(Histogram, ConcurrentMeasure) {
+  memgraph::metrics::Histogram histo{};
+
+  constexpr int kNumThreads = 8;
+  constexpr int kNumMeasurements = 10000;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; i++) {
+    threads.emplace_back([&histo, i] {
+      for (int j = 0; j < kNumMeasurements; j++) {
+        histo.Measure(i == 0 ? 500 : 10);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(histo.Count(), kNumThreads * kNumMeasurements);
+  ASSERT_EQ(histo.Sum(), kNumMeasurements * (500 + (kNumThreads - 1) * 10));
+  ASSERT_EQ(histo.Percentile(50.0), 10);
+  ASSERT_EQ(histo.Percentile(100.0), 500);
+}